@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <stdexcept>
 #include <algorithm>
+#include "alloc_tracking.hpp"
 
 template <typename T>
 class StackArrT {
@@ -12,6 +13,9 @@ public:
     StackArrT() = default;
     
     ~StackArrT() {
+        if (data_) {
+            ALLOC_TRACK_FREE("StackArrT", size_ * sizeof(T));
+        }
         delete[] data_;
     }
     
@@ -19,6 +23,8 @@ public:
         : size_(other.size_)
         , i_top_(other.i_top_) {
         data_ = new T[size_];
+        ALLOC_TRACK_ALLOC("StackArrT", size_ * sizeof(T));
+        ALLOC_TRACK_COPY("StackArrT", (i_top_ + 1) * sizeof(T));
         for (std::ptrdiff_t i = 0; i <= i_top_; ++i) {
             data_[i] = other.data_[i];
         }
@@ -37,6 +43,7 @@ public:
         : size_(list.size())
         , i_top_(list.size() - 1) {
         data_ = new T[size_];
+        ALLOC_TRACK_ALLOC("StackArrT", size_ * sizeof(T));
         std::ptrdiff_t i = 0;
         for (const auto& item : list) {
             data_[i++] = item;
@@ -47,9 +54,14 @@ public:
         if (i_top_ + 1 >= size_) {
             std::ptrdiff_t new_size = (size_ == 0) ? 1 : size_ * 2;
             T* new_data = new T[new_size];
+            ALLOC_TRACK_ALLOC("StackArrT", new_size * sizeof(T));
             for (std::ptrdiff_t i = 0; i <= i_top_; ++i) {
                 new_data[i] = data_[i];
             }
+            if (data_) {
+                ALLOC_TRACK_REALLOC("StackArrT");
+                ALLOC_TRACK_FREE("StackArrT", size_ * sizeof(T));
+            }
             delete[] data_;
             data_ = new_data;
             size_ = new_size;
@@ -84,6 +96,11 @@ public:
         
         std::ptrdiff_t new_size = size_ + other.size_;
         T* new_data = new T[new_size];
+        ALLOC_TRACK_ALLOC("StackArrT", new_size * sizeof(T));
+        if (data_) {
+            ALLOC_TRACK_REALLOC("StackArrT");
+            ALLOC_TRACK_FREE("StackArrT", size_ * sizeof(T));
+        }
         
         // Копируем элементы текущего стека
         for (std::ptrdiff_t i = 0; i <= i_top_; ++i) {
@@ -138,6 +155,9 @@ public:
     
     StackArrT<T>& operator=(StackArrT<T>&& other) {
         if (this != &other) {
+            if (data_) {
+                ALLOC_TRACK_FREE("StackArrT", size_ * sizeof(T));
+            }
             delete[] data_;
             size_ = other.size_;
             i_top_ = other.i_top_;
@@ -151,6 +171,9 @@ public:
     
 private:
     void clear() {
+        if (data_) {
+            ALLOC_TRACK_FREE("StackArrT", size_ * sizeof(T));
+        }
         delete[] data_;
         data_ = nullptr;
         size_ = 0;
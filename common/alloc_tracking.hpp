@@ -0,0 +1,341 @@
+// Единица трансляции видит один режим: повторное включение с другим
+// значением TRACK_ALLOCATIONS — ошибка
+#if defined(ALLOC_TRACKING_HPP) && defined(TRACK_ALLOCATIONS) != ALLOC_TRACKING_MODE
+#error "alloc_tracking.hpp included with and without TRACK_ALLOCATIONS in one translation unit"
+#endif
+
+#ifndef ALLOC_TRACKING_HPP
+#define ALLOC_TRACKING_HPP
+
+#ifdef TRACK_ALLOCATIONS
+#define ALLOC_TRACKING_MODE 1
+#else
+#define ALLOC_TRACKING_MODE 0
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+// Учёт выделений памяти контейнерами. Контейнеры отмечают свои выделения
+// макросами ALLOC_TRACK_*; без TRACK_ALLOCATIONS макросы ничего не делают
+// и аргументы не вычисляются. С ним счётчики копятся по типу контейнера,
+// по месту в коде контейнера (файл, строка, функция) и по области
+// вызывающего кода, а report_json() выдаёт их одним JSON-документом.
+//
+// Место в контейнере одно и то же для всех пользователей, поэтому
+// вызывающий код размечает свои участки сам; метка действует до конца
+// блока в текущем потоке, вложенная область заменяет внешнюю:
+//
+//   void load_index() {
+//       ALLOC_TRACK_SCOPE("load_index");
+//       ...
+//   }
+//
+// Режим входит в имена символов (inline namespace), так что единицы
+// трансляции с TRACK_ALLOCATIONS и без не делят inline-функций учёта.
+// Контейнеры-шаблоны так не разделены: программа собирается с одним
+// значением. Опция TRACK_ALLOCATIONS есть в CMake каждого проекта с
+// контейнерами; цель dynamic_array передаёт её как PUBLIC.
+//
+//   cmake -DTRACK_ALLOCATIONS=ON ...   или   g++ -DTRACK_ALLOCATIONS ...
+namespace alloc_tracking {
+
+#ifdef TRACK_ALLOCATIONS
+inline namespace tracked {
+#else
+inline namespace untracked {
+#endif
+
+struct Counters {
+    int64_t allocations = 0;
+    int64_t frees = 0;
+    int64_t bytes_allocated = 0;
+    int64_t bytes_freed = 0;
+    int64_t live_bytes = 0;       //!< выделено и ещё не освобождено
+    int64_t peak_bytes = 0;       //!< максимум live_bytes
+    int64_t reallocations = 0;    //!< переезды буфера при росте или слиянии
+    int64_t copies = 0;           //!< копирования контейнера целиком
+    int64_t bytes_copied = 0;
+};
+
+// Область вызывающего кода, к которой относятся выделения этого потока.
+// Метка хранится указателем и должна жить, пока идёт учёт (обычно литерал)
+class Scope {
+public:
+    explicit Scope(const char* label) : previous_(current()) { current() = label; }
+    ~Scope() { current() = previous_; }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    // Метка самой внутренней области потока; nullptr вне областей
+    static const char*& current() {
+        static thread_local const char* label = nullptr;
+        return label;
+    }
+
+private:
+    const char* previous_;
+};
+
+class Registry {
+public:
+    static Registry& instance() {
+        static Registry registry;
+        return registry;
+    }
+
+    void record_allocation(const char* container, size_t bytes, const char* file, int line, const char* function) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (Counters* c : targets(container, file, line, function)) {
+            ++c->allocations;
+            c->bytes_allocated += static_cast<int64_t>(bytes);
+            c->live_bytes += static_cast<int64_t>(bytes);
+            c->peak_bytes = std::max(c->peak_bytes, c->live_bytes);
+        }
+    }
+
+    void record_free(const char* container, size_t bytes, const char* file, int line, const char* function) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (Counters* c : targets(container, file, line, function)) {
+            ++c->frees;
+            c->bytes_freed += static_cast<int64_t>(bytes);
+            c->live_bytes -= static_cast<int64_t>(bytes);
+        }
+    }
+
+    void record_reallocation(const char* container, const char* file, int line, const char* function) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (Counters* c : targets(container, file, line, function)) {
+            ++c->reallocations;
+        }
+    }
+
+    void record_copy(const char* container, size_t bytes, const char* file, int line, const char* function) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (Counters* c : targets(container, file, line, function)) {
+            ++c->copies;
+            c->bytes_copied += static_cast<int64_t>(bytes);
+        }
+    }
+
+    // Сумма по всем местам контейнера; для неизвестного имени — нули
+    Counters counters(const std::string& container) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = containers_.find(container.c_str());
+        return it == containers_.end() ? Counters() : it->second;
+    }
+
+    // Выделения контейнера, вызванные из области scope
+    Counters counters(const std::string& container, const std::string& scope) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = scopes_.find(ScopeKey{scope.c_str(), container.c_str()});
+        return it == scopes_.end() ? Counters() : it->second;
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        containers_.clear();
+        scopes_.clear();
+        sites_.clear();
+    }
+
+    // {"enabled": ..., "containers": {"DynamicArray": {...}},
+    //  "scopes": [{"scope": ..., "container": ..., ...}], "sites": [{...}]}.
+    // У областей и мест live_bytes и peak_bytes не выводятся: память часто
+    // освобождает не то место, что выделило. Выделения вне областей
+    // попадают в область null.
+    void write_json(std::ostream& os) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        os << "{\n  \"enabled\": " << (ALLOC_TRACKING_MODE ? "true" : "false") << ",\n  \"containers\": {";
+        const char* sep = "\n";
+        for (const auto& [name, c] : containers_) {
+            os << sep << "    \"" << escape(name) << "\": {";
+            write_counters(os, c, true);
+            os << "}";
+            sep = ",\n";
+        }
+        os << (containers_.empty() ? "},\n" : "\n  },\n") << "  \"scopes\": [";
+        sep = "\n";
+        for (const auto& [key, c] : scopes_) {
+            os << sep << "    {\"scope\": " << quote(key.scope)
+               << ", \"container\": " << quote(key.container) << ", ";
+            write_counters(os, c, false);
+            os << "}";
+            sep = ",\n";
+        }
+        os << (scopes_.empty() ? "],\n" : "\n  ],\n") << "  \"sites\": [";
+        sep = "\n";
+        for (const auto& [site, c] : sites_) {
+            os << sep << "    {\"scope\": " << quote(site.scope)
+               << ", \"container\": " << quote(site.container)
+               << ", \"file\": " << quote(basename(site.file))
+               << ", \"line\": " << site.line
+               << ", \"function\": " << quote(site.function) << ", ";
+            write_counters(os, c, false);
+            os << "}";
+            sep = ",\n";
+        }
+        os << (sites_.empty() ? "]\n}\n" : "\n  ]\n}\n");
+    }
+
+private:
+    Registry() = default;
+
+    // Строки — литералы __FILE__, __func__ и меток областей, поэтому
+    // хранятся указатели; nullptr (вне областей) меньше любой строки
+    static int compare(const char* a, const char* b) {
+        if (a == nullptr || b == nullptr) {
+            return (a != nullptr) - (b != nullptr);
+        }
+        return std::strcmp(a, b);
+    }
+
+    struct CStrLess {
+        bool operator()(const char* a, const char* b) const { return compare(a, b) < 0; }
+    };
+
+    struct ScopeKey {
+        const char* scope;
+        const char* container;
+
+        bool operator<(const ScopeKey& rhs) const {
+            if (int c = compare(scope, rhs.scope)) {
+                return c < 0;
+            }
+            return compare(container, rhs.container) < 0;
+        }
+    };
+
+    struct Site {
+        const char* scope;
+        const char* container;
+        const char* file;
+        int line;
+        const char* function;
+
+        bool operator<(const Site& rhs) const {
+            if (int c = compare(scope, rhs.scope)) {
+                return c < 0;
+            }
+            if (int c = compare(container, rhs.container)) {
+                return c < 0;
+            }
+            if (int c = compare(file, rhs.file)) {
+                return c < 0;
+            }
+            return line < rhs.line;
+        }
+    };
+
+    // Счётчики контейнера, его области и места, куда идёт запись
+    std::array<Counters*, 3> targets(const char* container, const char* file, int line, const char* function) {
+        const char* scope = Scope::current();
+        return {&containers_[container], &scopes_[ScopeKey{scope, container}],
+                &sites_[Site{scope, container, file, line, function}]};
+    }
+
+    static const char* basename(const char* path) {
+        const char* slash = std::strrchr(path, '/');
+        return slash ? slash + 1 : path;
+    }
+
+    static std::string quote(const char* s) {
+        if (s == nullptr) {
+            return "null";
+        }
+        std::string out = "\"";
+        for (; *s; ++s) {
+            if (*s == '"' || *s == '\\') {
+                out += '\\';
+            }
+            out += *s;
+        }
+        return out + '"';
+    }
+
+    static std::string escape(const char* s) {
+        std::string quoted = quote(s);
+        return quoted.substr(1, quoted.size() - 2);
+    }
+
+    static void write_counters(std::ostream& os, const Counters& c, bool with_live) {
+        os << "\"allocations\": " << c.allocations
+           << ", \"frees\": " << c.frees
+           << ", \"bytes_allocated\": " << c.bytes_allocated
+           << ", \"bytes_freed\": " << c.bytes_freed;
+        if (with_live) {
+            os << ", \"live_bytes\": " << c.live_bytes
+               << ", \"peak_bytes\": " << c.peak_bytes;
+        }
+        os << ", \"reallocations\": " << c.reallocations
+           << ", \"copies\": " << c.copies
+           << ", \"bytes_copied\": " << c.bytes_copied;
+    }
+
+    mutable std::mutex mutex_;
+    std::map<const char*, Counters, CStrLess> containers_;
+    std::map<ScopeKey, Counters> scopes_;
+    std::map<Site, Counters> sites_;
+};
+
+inline constexpr bool enabled() {
+    return ALLOC_TRACKING_MODE;
+}
+
+inline Counters counters(const std::string& container) {
+    return Registry::instance().counters(container);
+}
+
+inline Counters counters(const std::string& container, const std::string& scope) {
+    return Registry::instance().counters(container, scope);
+}
+
+inline void reset() {
+    Registry::instance().reset();
+}
+
+inline void write_report(std::ostream& os) {
+    Registry::instance().write_json(os);
+}
+
+inline std::string report_json() {
+    std::ostringstream os;
+    write_report(os);
+    return os.str();
+}
+
+} // inline namespace tracked / untracked
+} // namespace alloc_tracking
+
+#define ALLOC_TRACK_CONCAT_(a, b) a##b
+#define ALLOC_TRACK_CONCAT(a, b) ALLOC_TRACK_CONCAT_(a, b)
+
+#ifdef TRACK_ALLOCATIONS
+#define ALLOC_TRACK_ALLOC(container, bytes) \
+    ::alloc_tracking::Registry::instance().record_allocation(container, bytes, __FILE__, __LINE__, __func__)
+#define ALLOC_TRACK_FREE(container, bytes) \
+    ::alloc_tracking::Registry::instance().record_free(container, bytes, __FILE__, __LINE__, __func__)
+#define ALLOC_TRACK_REALLOC(container) \
+    ::alloc_tracking::Registry::instance().record_reallocation(container, __FILE__, __LINE__, __func__)
+#define ALLOC_TRACK_COPY(container, bytes) \
+    ::alloc_tracking::Registry::instance().record_copy(container, bytes, __FILE__, __LINE__, __func__)
+#define ALLOC_TRACK_SCOPE(label) \
+    ::alloc_tracking::Scope ALLOC_TRACK_CONCAT(alloc_track_scope_, __LINE__)(label)
+#else
+#define ALLOC_TRACK_ALLOC(container, bytes) ((void)0)
+#define ALLOC_TRACK_FREE(container, bytes) ((void)0)
+#define ALLOC_TRACK_REALLOC(container) ((void)0)
+#define ALLOC_TRACK_COPY(container, bytes) ((void)0)
+#define ALLOC_TRACK_SCOPE(label) ((void)0)
+#endif
+
+#endif // ALLOC_TRACKING_HPP
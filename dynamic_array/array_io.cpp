@@ -0,0 +1,356 @@
+#include "array_io.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace array_io {
+
+namespace {
+
+constexpr int64_t kHeaderBytes = 64;
+constexpr char kMagic[8] = {'D', 'A', 'B', 'I', 'N', 'V', '0', '1'};
+// Порции меньше буфера копируются, чтобы не делать системный вызов на каждую
+constexpr int64_t kBufferElements = int64_t(1) << 18;   // 1 МиБ
+
+struct Header {
+    char magic[8];
+    uint8_t type;
+    uint8_t element_size;
+    uint8_t byte_order;
+    uint8_t reserved[5];
+    int64_t count;              //!< в порядке байтов файла
+    char padding[kHeaderBytes - 24];
+};
+
+static_assert(sizeof(Header) == kHeaderBytes, "Header must occupy exactly kHeaderBytes");
+
+[[noreturn]] void throw_errno(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+Header make_header(int64_t count) {
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.type = static_cast<uint8_t>(ElementType::Int32);
+    header.element_size = sizeof(int);
+    header.byte_order = static_cast<uint8_t>(native_byte_order());
+    header.count = count;
+    return header;
+}
+
+// Проверяет заголовок и приводит count к порядку байтов машины
+FileInfo parse_header(Header header, int64_t file_bytes, const std::string& path) {
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error("Not an array file: " + path);
+    }
+    if (header.type != static_cast<uint8_t>(ElementType::Int32) || header.element_size != sizeof(int)) {
+        throw std::runtime_error("Unsupported element type in array file: " + path);
+    }
+    if (header.byte_order != static_cast<uint8_t>(ByteOrder::Little) &&
+        header.byte_order != static_cast<uint8_t>(ByteOrder::Big)) {
+        throw std::runtime_error("Corrupted array header: " + path);
+    }
+    FileInfo info{ElementType::Int32, static_cast<ByteOrder>(header.byte_order), header.count};
+    if (info.byte_order != native_byte_order()) {
+        info.count = static_cast<int64_t>(__builtin_bswap64(static_cast<uint64_t>(info.count)));
+    }
+    if (info.count < 0 || info.count > (file_bytes - kHeaderBytes) / static_cast<int64_t>(sizeof(int))) {
+        throw std::runtime_error("Truncated or corrupted array file: " + path);
+    }
+    return info;
+}
+
+// Открывает файл и читает заголовок; fd закрывается при ошибке
+FileInfo open_array(const std::string& path, int& fd, int64_t& file_bytes) {
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw_errno("open");
+    }
+    struct stat st {};
+    Header header{};
+    if (fstat(fd, &st) != 0) {
+        int err = errno;
+        ::close(fd);
+        throw std::system_error(err, std::generic_category(), "fstat");
+    }
+    file_bytes = st.st_size;
+    if (file_bytes < kHeaderBytes || pread(fd, &header, sizeof(header), 0) != sizeof(header)) {
+        ::close(fd);
+        throw std::runtime_error("Not an array file: " + path);
+    }
+    try {
+        return parse_header(header, file_bytes, path);
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+}
+
+// writev до конца, продвигая iovec после неполной записи: Linux передаёт
+// за один вызов не больше ~2 ГиБ
+void write_all(int fd, iovec* iov, int count) {
+    while (count > 0) {
+        ssize_t done = ::writev(fd, iov, count);
+        if (done < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_errno("writev");
+        }
+        size_t left = static_cast<size_t>(done);
+        while (count > 0 && left >= iov->iov_len) {
+            left -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+        if (count > 0) {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+            iov->iov_len -= left;
+        }
+    }
+}
+
+void read_all(int fd, void* data, size_t bytes, off_t offset) {
+    char* p = static_cast<char*>(data);
+    while (bytes > 0) {
+        ssize_t done = pread(fd, p, bytes, offset);
+        if (done < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_errno("pread");
+        }
+        if (done == 0) {
+            throw std::runtime_error("Unexpected end of array file");
+        }
+        p += done;
+        offset += done;
+        bytes -= static_cast<size_t>(done);
+    }
+}
+
+int open_for_write(const std::string& path) {
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw_errno("open");
+    }
+    return fd;
+}
+
+} // namespace
+
+ByteOrder native_byte_order() {
+    const uint32_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1 ? ByteOrder::Little : ByteOrder::Big;
+}
+
+FileInfo read_info(const std::string& path) {
+    int fd = -1;
+    int64_t file_bytes = 0;
+    FileInfo info = open_array(path, fd, file_bytes);
+    ::close(fd);
+    return info;
+}
+
+void save(const std::string& path, ArrayView values) {
+    Writer writer(path);
+    writer.write(values);
+    writer.finish();
+}
+
+DynamicArray load(const std::string& path) {
+    int fd = -1;
+    int64_t file_bytes = 0;
+    FileInfo info = open_array(path, fd, file_bytes);
+    DynamicArray result;
+    try {
+        // Буфер не заполняется заранее: каждая страница пишется один раз, самим read
+        result.resize_for_overwrite(info.count);
+        int* data = result.begin();
+#if defined(POSIX_FADV_SEQUENTIAL)
+        posix_fadvise(fd, kHeaderBytes, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+        read_all(fd, data, static_cast<size_t>(info.count) * sizeof(int), kHeaderBytes);
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+    ::close(fd);
+    if (info.byte_order != native_byte_order()) {
+        for (int& v : result) {
+            v = static_cast<int>(__builtin_bswap32(static_cast<uint32_t>(v)));
+        }
+    }
+    return result;
+}
+
+Writer::Writer(const std::string& path)
+    : fd(open_for_write(path)), buffer(new int[kBufferElements]) {}
+
+Writer::~Writer() {
+    if (fd >= 0) {
+        try {
+            finish();
+        } catch (...) {
+            // Деструктор не бросает; файл с недописанным заголовком читается как пустой
+        }
+    }
+}
+
+void Writer::write(int value) {
+    if (fd < 0) {
+        throw std::logic_error("Writer is finished");
+    }
+    if (buffered == kBufferElements) {
+        flush(nullptr, 0);
+    }
+    buffer[buffered++] = value;
+}
+
+void Writer::write(const int* values, int64_t count) {
+    if (fd < 0) {
+        throw std::logic_error("Writer is finished");
+    }
+    if (count < 0) {
+        throw std::invalid_argument("Size cannot be negative");
+    }
+    if (count >= kBufferElements) {
+        // Крупная порция не копируется: буфер и она уходят одним writev
+        flush(values, count);
+        return;
+    }
+    if (buffered + count > kBufferElements) {
+        flush(nullptr, 0);
+    }
+    std::copy(values, values + count, buffer.get() + buffered);
+    buffered += count;
+}
+
+void Writer::write(ArrayView values) {
+    write(values.data(), values.Size());
+}
+
+void Writer::flush(const int* direct, int64_t direct_count) {
+    Header header = make_header(0);
+    iovec iov[3];
+    int n = 0;
+    if (!header_written) {
+        iov[n++] = iovec{&header, sizeof(header)};
+    }
+    if (buffered > 0) {
+        iov[n++] = iovec{buffer.get(), static_cast<size_t>(buffered) * sizeof(int)};
+    }
+    if (direct_count > 0) {
+        iov[n++] = iovec{const_cast<int*>(direct), static_cast<size_t>(direct_count) * sizeof(int)};
+    }
+    write_all(fd, iov, n);
+    header_written = true;
+    written += buffered + direct_count;
+    buffered = 0;
+}
+
+void Writer::finish() {
+    if (fd < 0) {
+        return;
+    }
+    flush(nullptr, 0);
+    Header header = make_header(written);
+    if (pwrite(fd, &header, sizeof(header), 0) != sizeof(header)) {
+        int err = errno;
+        ::close(fd);
+        fd = -1;
+        throw std::system_error(err, std::generic_category(), "pwrite");
+    }
+    int rc = ::close(fd);
+    fd = -1;
+    if (rc != 0) {
+        throw_errno("close");
+    }
+}
+
+int64_t Writer::count() const { return written + buffered; }
+
+MappedFile::MappedFile(const std::string& path) {
+    int fd = -1;
+    int64_t file_bytes = 0;
+    FileInfo info = open_array(path, fd, file_bytes);
+    if (info.byte_order != native_byte_order()) {
+        ::close(fd);
+        throw std::runtime_error("Array file has foreign byte order, use load(): " + path);
+    }
+    length = static_cast<size_t>(kHeaderBytes) + static_cast<size_t>(info.count) * sizeof(int);
+    void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    int err = errno;
+    // Отображение остаётся действительным после закрытия дескриптора
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        throw std::system_error(err, std::generic_category(), "mmap");
+    }
+    base = static_cast<char*>(p);
+    data = reinterpret_cast<const int*>(base + kHeaderBytes);
+    size = info.count;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : base(other.base), length(other.length), data(other.data), size(other.size) {
+    other.base = nullptr;
+    other.length = 0;
+    other.data = nullptr;
+    other.size = 0;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& rhs) noexcept {
+    if (this != &rhs) {
+        close();
+        base = rhs.base;
+        length = rhs.length;
+        data = rhs.data;
+        size = rhs.size;
+        rhs.base = nullptr;
+        rhs.length = 0;
+        rhs.data = nullptr;
+        rhs.size = 0;
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+void MappedFile::close() noexcept {
+    if (base != nullptr) {
+        munmap(base, length);
+        base = nullptr;
+    }
+}
+
+int64_t MappedFile::Size() const { return size; }
+bool MappedFile::empty() const { return size == 0; }
+
+const int* MappedFile::begin() const { return data; }
+const int* MappedFile::end() const { return data + size; }
+
+const int& MappedFile::operator[](int64_t i) const { return data[i]; }
+
+const int& MappedFile::at(int64_t i) const {
+    if (i < 0 || i >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return data[i];
+}
+
+ArrayView MappedFile::view() const { return ArrayView(data, size); }
+
+} // namespace array_io
@@ -0,0 +1,113 @@
+#ifndef ARRAY_IO_HPP
+#define ARRAY_IO_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "array_view.hpp"
+#include "dynamic_array.hpp"
+
+// Двоичный формат массива: 64-байтный заголовок (сигнатура, тип и размер
+// элемента, порядок байтов, число элементов) и сразу за ним элементы.
+// Данные начинаются с выровненного смещения, поэтому файл можно отображать
+// в память и читать без копирования.
+namespace array_io {
+
+enum class ElementType : uint8_t {
+    Int32 = 1
+};
+
+enum class ByteOrder : uint8_t {
+    Little = 1,
+    Big = 2
+};
+
+// Порядок байтов этой машины
+ByteOrder native_byte_order();
+
+struct FileInfo {
+    ElementType type;
+    ByteOrder byte_order;
+    int64_t count;
+};
+
+// Читает и проверяет заголовок; std::runtime_error для чужого или повреждённого файла
+FileInfo read_info(const std::string& path);
+
+// Записывает файл целиком одним writev
+void save(const std::string& path, ArrayView values);
+
+// Читает файл одним проходом read в неинициализированный буфер массива.
+// Файл с другим порядком байтов переворачивается после чтения.
+DynamicArray load(const std::string& path);
+
+// Потоковая запись: мелкие порции копируются в буфер, крупные уходят в
+// файл напрямую вместе с содержимым буфера одним writev. Число элементов
+// записывается в заголовок в finish() (или деструкторе).
+class Writer {
+public:
+    explicit Writer(const std::string& path);
+
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    // Завершает запись; ошибки при этом не сообщаются — для них есть finish()
+    ~Writer();
+
+    void write(int value);
+    void write(const int* values, int64_t count);
+    void write(ArrayView values);
+
+    // Сбрасывает буфер, записывает заголовок и закрывает файл
+    void finish();
+
+    int64_t count() const;
+
+private:
+    void flush(const int* direct, int64_t direct_count);
+
+    int fd = -1;
+    std::unique_ptr<int[]> buffer;
+    int64_t buffered = 0;
+    int64_t written = 0;        //!< элементов уже в файле
+    bool header_written = false;
+};
+
+// Файл массива, отображённый в память только для чтения: ничего не
+// копируется, страницы подгружаются ОС при обращении. Файл должен быть
+// в порядке байтов этой машины, иначе std::runtime_error.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& rhs) noexcept;
+
+    ~MappedFile();
+
+    int64_t Size() const;
+    bool empty() const;
+
+    const int* begin() const;
+    const int* end() const;
+
+    const int& operator[](int64_t i) const;
+    const int& at(int64_t i) const;
+
+    ArrayView view() const;
+
+private:
+    void close() noexcept;
+
+    char* base = nullptr;       //!< начало отображения (заголовок)
+    size_t length = 0;
+    const int* data = nullptr;
+    int64_t size = 0;
+};
+
+} // namespace array_io
+
+#endif // ARRAY_IO_HPP
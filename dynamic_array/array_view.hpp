@@ -0,0 +1,229 @@
+#ifndef ARRAY_VIEW_HPP
+#define ARRAY_VIEW_HPP
+
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "dynamic_array.hpp"
+
+// Невладеющие представления непрерывного участка int: ArrayView только для
+// чтения, ArraySpan — с записью. Подучастки, разбиение на части и шаговые
+// представления ничего не копируют. Представление действительно, пока жив
+// исходный массив и его буфер не перераспределён.
+template <typename T>
+class BasicStridedView;
+
+template <typename T>
+class BasicArrayView {
+    static_assert(std::is_same<std::remove_const_t<T>, int>::value, "Views are defined over int");
+
+public:
+    BasicArrayView() = default;
+    BasicArrayView(T* data, int64_t size) : data_(data), size_(size) {
+        if (size < 0) {
+            throw std::invalid_argument("Size cannot be negative");
+        }
+    }
+
+    // ArrayView строится из константного массива, ArraySpan — только из изменяемого
+    template <typename U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+    BasicArrayView(const DynamicArray& arr) : data_(arr.begin()), size_(arr.Size()) {}
+
+    template <typename U = T, typename = std::enable_if_t<!std::is_const<U>::value>>
+    BasicArrayView(DynamicArray& arr) : data_(arr.begin()), size_(arr.Size()) {}
+
+    // ArraySpan приводится к ArrayView
+    template <typename U, typename = std::enable_if_t<std::is_const<T>::value && !std::is_const<U>::value>>
+    BasicArrayView(const BasicArrayView<U>& other) : data_(other.data()), size_(other.Size()) {}
+
+    int64_t Size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    T* data() const { return data_; }
+    T* begin() const { return data_; }
+    T* end() const { return data_ + size_; }
+
+    T& operator[](int64_t i) const { return data_[i]; }
+
+    T& at(int64_t i) const {
+        if (i < 0 || i >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return data_[i];
+    }
+
+    // Участок [offset, offset + len)
+    BasicArrayView subview(int64_t offset, int64_t len) const {
+        if (offset < 0 || len < 0 || offset > size_ || len > size_ - offset) {
+            throw std::out_of_range("Index out of range");
+        }
+        return BasicArrayView(data_ + offset, len);
+    }
+
+    // Участок от offset до конца
+    BasicArrayView subview(int64_t offset) const {
+        return subview(offset, size_ - offset);
+    }
+
+    // Каждый step-й элемент, начиная с первого
+    BasicStridedView<T> strided(int64_t step) const;
+
+    // Ровно pieces смежных частей, размеры которых отличаются не больше чем на 1
+    std::vector<BasicArrayView> chunks(int64_t pieces) const {
+        if (pieces <= 0) {
+            throw std::invalid_argument("Number of chunks must be positive");
+        }
+        std::vector<BasicArrayView> result;
+        result.reserve(static_cast<size_t>(pieces));
+        int64_t base = size_ / pieces;
+        int64_t extra = size_ % pieces;
+        int64_t offset = 0;
+        for (int64_t c = 0; c < pieces; ++c) {
+            int64_t len = base + (c < extra ? 1 : 0);
+            result.push_back(BasicArrayView(data_ + offset, len));
+            offset += len;
+        }
+        return result;
+    }
+
+private:
+    T* data_ = nullptr;
+    int64_t size_ = 0;
+};
+
+using ArrayView = BasicArrayView<const int>;
+using ArraySpan = BasicArrayView<int>;
+
+// Элементы data[0], data[stride], data[2 * stride], ...
+template <typename T>
+class BasicStridedView {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::remove_const_t<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator() = default;
+        iterator(T* data, int64_t index, int64_t stride) : data_(data), index_(index), stride_(stride) {}
+
+        // Итератор StridedSpan приводится к итератору StridedView
+        template <typename U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+        iterator(const typename BasicStridedView<std::remove_const_t<U>>::iterator& other)
+            : data_(other.data_), index_(other.index_), stride_(other.stride_) {}
+
+        reference operator*() const { return data_[index_ * stride_]; }
+        pointer operator->() const { return &data_[index_ * stride_]; }
+        reference operator[](difference_type n) const { return data_[(index_ + n) * stride_]; }
+
+        iterator& operator++() { ++index_; return *this; }
+        iterator operator++(int) { iterator tmp = *this; ++index_; return tmp; }
+        iterator& operator--() { --index_; return *this; }
+        iterator operator--(int) { iterator tmp = *this; --index_; return tmp; }
+        iterator& operator+=(difference_type n) { index_ += n; return *this; }
+        iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+
+        friend iterator operator+(iterator it, difference_type n) { return it += n; }
+        friend iterator operator+(difference_type n, iterator it) { return it += n; }
+        friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const iterator& a, const iterator& b) { return a.index_ - b.index_; }
+
+        friend bool operator==(const iterator& a, const iterator& b) { return a.index_ == b.index_; }
+        friend bool operator!=(const iterator& a, const iterator& b) { return a.index_ != b.index_; }
+        friend bool operator<(const iterator& a, const iterator& b) { return a.index_ < b.index_; }
+        friend bool operator>(const iterator& a, const iterator& b) { return a.index_ > b.index_; }
+        friend bool operator<=(const iterator& a, const iterator& b) { return a.index_ <= b.index_; }
+        friend bool operator>=(const iterator& a, const iterator& b) { return a.index_ >= b.index_; }
+
+    private:
+        template <typename>
+        friend class BasicStridedView;
+
+        T* data_ = nullptr;
+        int64_t index_ = 0;
+        int64_t stride_ = 1;
+    };
+
+    BasicStridedView() = default;
+    BasicStridedView(T* data, int64_t size, int64_t stride) : data_(data), size_(size), stride_(stride) {
+        if (size < 0) {
+            throw std::invalid_argument("Size cannot be negative");
+        }
+        if (stride <= 0) {
+            throw std::invalid_argument("Stride must be positive");
+        }
+    }
+
+    // StridedSpan приводится к StridedView
+    template <typename U, typename = std::enable_if_t<std::is_const<T>::value && !std::is_const<U>::value>>
+    BasicStridedView(const BasicStridedView<U>& other)
+        : data_(other.begin().data_), size_(other.Size()), stride_(other.stride()) {}
+
+    using const_iterator = typename BasicStridedView<const T>::iterator;
+
+    int64_t Size() const { return size_; }
+    int64_t stride() const { return stride_; }
+    bool empty() const { return size_ == 0; }
+
+    iterator begin() const { return iterator(data_, 0, stride_); }
+    iterator end() const { return iterator(data_, size_, stride_); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    T& operator[](int64_t i) const { return data_[i * stride_]; }
+
+    T& at(int64_t i) const {
+        if (i < 0 || i >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return data_[i * stride_];
+    }
+
+    BasicStridedView subview(int64_t offset, int64_t len) const {
+        if (offset < 0 || len < 0 || offset > size_ || len > size_ - offset) {
+            throw std::out_of_range("Index out of range");
+        }
+        if (len == 0) {
+            return BasicStridedView(data_, 0, stride_);
+        }
+        return BasicStridedView(data_ + offset * stride_, len, stride_);
+    }
+
+private:
+    T* data_ = nullptr;
+    int64_t size_ = 0;
+    int64_t stride_ = 1;
+};
+
+using StridedView = BasicStridedView<const int>;
+using StridedSpan = BasicStridedView<int>;
+
+template <typename T>
+BasicStridedView<T> BasicArrayView<T>::strided(int64_t step) const {
+    if (step <= 0) {
+        throw std::invalid_argument("Stride must be positive");
+    }
+    return BasicStridedView<T>(data_, (size_ + step - 1) / step, step);
+}
+
+namespace simd {
+// Определена в dynamic_array_simd.cpp; объявлена здесь, чтобы заголовок не
+// тянул за собой весь SIMD-интерфейс
+bool equal(ArrayView lhs, ArrayView rhs);
+} // namespace simd
+
+// Сравнение тем же векторизованным алгоритмом, что и DynamicArray::operator==
+inline bool operator==(ArrayView lhs, ArrayView rhs) {
+    return simd::equal(lhs, rhs);
+}
+
+inline bool operator!=(ArrayView lhs, ArrayView rhs) {
+    return !(lhs == rhs);
+}
+
+#endif // ARRAY_VIEW_HPP
@@ -0,0 +1,77 @@
+// Случайный доступ к большому массиву при разных параметрах хранения:
+// выравнивание буфера и страницы по 2 МиБ (MADV_HUGEPAGE). Независимые
+// чтения показывают пропускную способность, цепочка зависимых чтений —
+// задержку промахов TLB.
+//
+//   bench_alignment [N] [reads]   (по умолчанию N = 2^28 int = 1 ГиБ, 2 * 10^7 чтений)
+
+#include "dynamic_array.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+template <typename F>
+double measure(F body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct Config {
+    const char* name;
+    Alignment alignment;
+    bool huge_pages;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int64_t n = argc > 1 ? std::atoll(argv[1]) : int64_t(1) << 28;
+    int64_t reads = argc > 2 ? std::atoll(argv[2]) : 20000000LL;
+
+    const Config configs[] = {
+        {"default", Alignment::Default, false},
+        {"64 B", Alignment::CacheLine, false},
+        {"4 KiB", Alignment::Page, false},
+        {"4 KiB + huge pages", Alignment::Page, true},
+    };
+
+    std::printf("N = %lld (%.0f MiB), reads = %lld\n", static_cast<long long>(n),
+                n * sizeof(int) / 1048576.0, static_cast<long long>(reads));
+    std::printf("%-20s %14s %14s\n", "", "random Mreads/s", "chain ns/read");
+    for (const Config& config : configs) {
+        DynamicArray arr(n, 0, config.alignment, config.huge_pages);
+        // Случайная перестановка-цикл для зависимых чтений: arr[i] — следующий индекс
+        uint64_t state = 88172645463325252ULL;
+        auto next_random = [&] {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        };
+        for (int64_t i = 0; i < n; ++i)
+            arr[i] = static_cast<int>(i);
+        for (int64_t i = n - 1; i > 0; --i) {
+            int64_t j = static_cast<int64_t>(next_random() % static_cast<uint64_t>(i));
+            std::swap(arr[i], arr[j]);
+        }
+
+        long long sum = 0;
+        double independent = measure([&] {
+            for (int64_t r = 0; r < reads; ++r)
+                sum += arr[static_cast<int64_t>(next_random() % static_cast<uint64_t>(n))];
+        });
+        int64_t pos = 0;
+        double chain = measure([&] {
+            for (int64_t r = 0; r < reads; ++r)
+                pos = arr[pos];
+        });
+        std::printf("%-20s %14.1f %14.1f   (check %lld)\n", config.name, reads / independent / 1e6,
+                    chain * 1e9 / reads, static_cast<long long>((sum + pos) & 0xff));
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+// Сохранение и загрузка массива: текст (ofstream/ifstream) против двоичного
+// формата array_io (writev, один read, отображение в память). Файлы читаются
+// из страничного кэша, так что измеряется разбор и копирование, а не диск.
+//
+//   bench_array_io [N] [dir]   (по умолчанию N = 5 * 10^7, dir — временный каталог)
+
+#include "array_io.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <random>
+
+namespace {
+
+template <typename F>
+double measure(F body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int64_t n = argc > 1 ? std::atoll(argv[1]) : 50000000LL;
+    std::filesystem::path dir = argc > 2 ? std::filesystem::path(argv[2]) : std::filesystem::temp_directory_path();
+    std::string text_path = (dir / "bench_array_io.txt").string();
+    std::string bin_path = (dir / "bench_array_io.bin").string();
+
+    std::mt19937 gen(1);
+    DynamicArray arr(n);
+    for (int64_t i = 0; i < n; ++i)
+        arr[i] = static_cast<int>(gen());
+
+    double text_save = measure([&] {
+        std::ofstream out(text_path);
+        for (int v : arr)
+            out << v << '\n';
+    });
+    double bin_save = measure([&] { array_io::save(bin_path, arr); });
+
+    long long check_text = 0;
+    double text_load = measure([&] {
+        std::ifstream in(text_path);
+        DynamicArray loaded;
+        loaded.reserve(n);
+        int v;
+        while (in >> v)
+            loaded.push_back(v);
+        check_text = std::accumulate(loaded.begin(), loaded.end(), 0LL);
+    });
+    long long check_load = 0;
+    double bin_load = measure([&] {
+        DynamicArray loaded = array_io::load(bin_path);
+        check_load = std::accumulate(loaded.begin(), loaded.end(), 0LL);
+    });
+    long long check_map = 0;
+    double bin_map = measure([&] {
+        array_io::MappedFile file(bin_path);
+        check_map = std::accumulate(file.begin(), file.end(), 0LL);
+    });
+
+    std::printf("N = %lld (%.0f MiB)\n", static_cast<long long>(n), n * sizeof(int) / 1048576.0);
+    std::printf("%-26s %10s %10s\n", "", "seconds", "speedup");
+    std::printf("%-26s %10.3f %10.2f\n", "text save", text_save, 1.0);
+    std::printf("%-26s %10.3f %10.2f\n", "binary save (writev)", bin_save, text_save / bin_save);
+    std::printf("%-26s %10.3f %10.2f\n", "text load + sum", text_load, 1.0);
+    std::printf("%-26s %10.3f %10.2f\n", "binary load (read) + sum", bin_load, text_load / bin_load);
+    std::printf("%-26s %10.3f %10.2f\n", "binary mmap + sum", bin_map, text_load / bin_map);
+
+    std::filesystem::remove(text_path);
+    std::filesystem::remove(bin_path);
+    if (check_text != check_load || check_load != check_map) {
+        std::printf("checksum mismatch\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+// Добавление из многих потоков: DynamicArray под мьютексом против
+// ConcurrentAppendArray.
+//
+//   bench_concurrent_append [N] [max_threads]   (по умолчанию N = 10^8, до 32 потоков)
+
+#include "concurrent_append_array.hpp"
+#include "dynamic_array.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+template <typename Body>
+double run_threads(unsigned threads, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t)
+        pool.emplace_back(body, t);
+    for (auto& thread : pool)
+        thread.join();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int64_t n = argc > 1 ? std::atoll(argv[1]) : 100000000LL;
+    unsigned max_threads = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 32;
+
+    std::printf("N = %lld\n", static_cast<long long>(n));
+    std::printf("%8s %14s %14s %8s\n", "threads", "mutex, Mops/s", "atomic, Mops/s", "speedup");
+
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+        int64_t per_thread = n / threads;
+
+        DynamicArray locked;
+        std::mutex mutex;
+        double with_mutex = run_threads(threads, [&](unsigned t) {
+            for (int64_t i = 0; i < per_thread; ++i) {
+                std::lock_guard<std::mutex> guard(mutex);
+                locked.push_back(static_cast<int>(t + i));
+            }
+        });
+
+        ConcurrentAppendArray<int> shared;
+        double lock_free = run_threads(threads, [&](unsigned t) {
+            for (int64_t i = 0; i < per_thread; ++i)
+                shared.push_back(static_cast<int>(t + i));
+        });
+
+        double total = static_cast<double>(per_thread * threads) / 1e6;
+        std::printf("%8u %14.1f %14.1f %8.2f\n", threads, total / with_mutex, total / lock_free, with_mutex / lock_free);
+    }
+    return 0;
+}
@@ -0,0 +1,395 @@
+// DynamicArray против std::vector<int> на основных операциях и размерах
+// от 10 до 10^9 элементов. Для каждой пары (операция, размер) выводится
+// время на элемент/операцию и число обращений к аллокатору в том же
+// замере: malloc, calloc, realloc, aligned_alloc, mmap и mremap подменены
+// в этой программе считающими обёртками (glibc), так что считается ровно
+// тот путь, время которого измеряется (realloc/mremap у DynamicArray,
+// operator new -> malloc у std::vector).
+//
+//   bench_dynamic_array [--max N] [--json out.json] [--baseline old.json] [--threshold P]
+//
+// Размеры, которым не хватит памяти машины, пропускаются. С --baseline
+// программа завершается с кодом 1, если DynamicArray стал медленнее
+// базового прогона больше чем на P процентов (по умолчанию 10) хотя бы в
+// одной точке; замер короче 1 мкс целиком (время на операцию, умноженное
+// на число операций ops из JSON) не сравнивается — шум.
+
+#include "dynamic_array.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include <dlfcn.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+// Обращения к аллокатору с начала программы
+int64_t allocator_calls = 0;
+
+} // namespace
+
+// Считающие обёртки над аллокатором glibc. free не считается: замер
+// показывает, сколько раз контейнер просил память
+extern "C" {
+
+void* __libc_malloc(size_t bytes);
+void* __libc_calloc(size_t count, size_t bytes);
+void* __libc_realloc(void* p, size_t bytes);
+void* __libc_memalign(size_t alignment, size_t bytes);
+
+void* malloc(size_t bytes) noexcept {
+    ++allocator_calls;
+    return __libc_malloc(bytes);
+}
+
+void* calloc(size_t count, size_t bytes) noexcept {
+    ++allocator_calls;
+    return __libc_calloc(count, bytes);
+}
+
+void* realloc(void* p, size_t bytes) noexcept {
+    ++allocator_calls;
+    return __libc_realloc(p, bytes);
+}
+
+void* aligned_alloc(size_t alignment, size_t bytes) noexcept {
+    ++allocator_calls;
+    return __libc_memalign(alignment, bytes);
+}
+
+void* mmap(void* addr, size_t length, int prot, int flags, int fd, off_t offset) noexcept {
+    using Fn = void* (*)(void*, size_t, int, int, int, off_t);
+    static Fn real = reinterpret_cast<Fn>(dlsym(RTLD_NEXT, "mmap"));
+    ++allocator_calls;
+    return real(addr, length, prot, flags, fd, offset);
+}
+
+void* mremap(void* old_address, size_t old_size, size_t new_size, int flags, ...) noexcept {
+    using Fn = void* (*)(void*, size_t, size_t, int, ...);
+    static Fn real = reinterpret_cast<Fn>(dlsym(RTLD_NEXT, "mremap"));
+    ++allocator_calls;
+    return real(old_address, old_size, new_size, flags);
+}
+
+} // extern "C"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Замер одной операции: время и выделения внутри [start, stop)
+struct Sample {
+    double seconds = 0;
+    int64_t ops = 0;
+    int64_t allocations = 0;
+};
+
+class Timer {
+public:
+    Timer() : allocations(allocator_calls), start(Clock::now()) {}
+
+    Sample stop(int64_t ops) const {
+        Sample s;
+        s.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        s.ops = ops;
+        s.allocations = allocator_calls - allocations;
+        return s;
+    }
+
+private:
+    int64_t allocations;
+    Clock::time_point start;
+};
+
+volatile int64_t sink;
+
+// Единый интерфейс к обоим контейнерам
+int64_t size_of(const DynamicArray& arr) { return arr.Size(); }
+template <typename V>
+int64_t size_of(const V& v) { return static_cast<int64_t>(v.size()); }
+
+void insert_at(DynamicArray& arr, int64_t i, int value) { arr.insert(i, value); }
+template <typename V>
+void insert_at(V& v, int64_t i, int value) { v.insert(v.begin() + i, value); }
+
+void erase_at(DynamicArray& arr, int64_t i) { arr.erase(i); }
+template <typename V>
+void erase_at(V& v, int64_t i) { v.erase(v.begin() + i); }
+
+template <typename C>
+C make_filled(int64_t n) {
+    C c;
+    c.resize(n);
+    for (int64_t i = 0; i < n; ++i)
+        c[i] = static_cast<int>(i);
+    return c;
+}
+
+uint64_t next_random(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+enum class Where { Front, Middle, Back };
+
+int64_t position(int64_t size, Where where) {
+    switch (where) {
+    case Where::Front:
+        return 0;
+    case Where::Middle:
+        return size / 2;
+    default:
+        return size;
+    }
+}
+
+// Вставки и удаления в начале и середине стоят O(n): их число ограничено,
+// чтобы на больших массивах один замер сдвигал не больше ~4 ГиБ
+int64_t edit_count(int64_t n) {
+    return std::max<int64_t>(1, std::min<int64_t>(1000, 1000000000LL / std::max<int64_t>(n, 1)));
+}
+
+template <typename C>
+Sample run_op(const std::string& op, int64_t n) {
+    if (op == "push_back" || op == "push_back_reserved") {
+        C c;
+        Timer t;
+        if (op == "push_back_reserved")
+            c.reserve(n);
+        for (int64_t i = 0; i < n; ++i)
+            c.push_back(static_cast<int>(i));
+        Sample s = t.stop(n);
+        sink = c[n / 2];
+        return s;
+    }
+    if (op == "resize") {
+        C c;
+        Timer t;
+        c.resize(n);
+        Sample s = t.stop(n);
+        sink = c[n / 2];
+        return s;
+    }
+
+    C c = make_filled<C>(n);
+    if (op == "random_access") {
+        uint64_t state = 88172645463325252ULL;
+        int64_t sum = 0;
+        Timer t;
+        for (int64_t i = 0; i < n; ++i)
+            sum += c[static_cast<int64_t>(next_random(state) % static_cast<uint64_t>(n))];
+        Sample s = t.stop(n);
+        sink = sum;
+        return s;
+    }
+    if (op == "iterate") {
+        int64_t sum = 0;
+        Timer t;
+        for (int value : c)
+            sum += value;
+        Sample s = t.stop(n);
+        sink = sum;
+        return s;
+    }
+    if (op == "copy") {
+        Timer t;
+        C copy(c);
+        Sample s = t.stop(n);
+        sink = copy[n / 2];
+        return s;
+    }
+
+    Where where = Where::Back;
+    if (op.find("front") != std::string::npos)
+        where = Where::Front;
+    else if (op.find("middle") != std::string::npos)
+        where = Where::Middle;
+    int64_t k = edit_count(n);
+    if (op.rfind("insert", 0) == 0) {
+        Timer t;
+        for (int64_t i = 0; i < k; ++i)
+            insert_at(c, position(size_of(c), where), static_cast<int>(i));
+        Sample s = t.stop(k);
+        sink = size_of(c);
+        return s;
+    }
+    k = std::min(k, n);
+    Timer t;
+    for (int64_t i = 0; i < k; ++i)
+        erase_at(c, std::min(position(size_of(c), where), size_of(c) - 1));
+    Sample s = t.stop(k);
+    sink = size_of(c);
+    return s;
+}
+
+struct Result {
+    double ns = 1e300;          //!< лучшее время на элемент/операцию
+    int64_t ops = 0;            //!< элементов/операций в одном замере
+    int64_t allocations = 0;    //!< обращений к аллокатору в одном замере
+};
+
+// Лучший из повторов, пока суммарное время не наберёт min_seconds (не меньше трёх повторов)
+template <typename C>
+Result best(const std::string& op, int64_t n) {
+    const double min_seconds = 0.05;
+    Result r;
+    double total = 0;
+    for (int rep = 0; rep < 3 || total < min_seconds; ++rep) {
+        Sample s = run_op<C>(op, n);
+        r.ns = std::min(r.ns, s.seconds / static_cast<double>(std::max<int64_t>(s.ops, 1)) * 1e9);
+        r.ops = s.ops;
+        r.allocations = s.allocations;   // одинаково во всех повторах
+        total += s.seconds;
+        if (s.seconds > 1.0)
+            break;   // больших размеров хватает одного замера
+    }
+    return r;
+}
+
+struct Row {
+    std::string op;
+    int64_t n;
+    int64_t ops;
+    double dynamic_array_ns;
+    double vector_ns;
+    int64_t dynamic_array_allocs;
+    int64_t vector_allocs;
+};
+
+struct Baseline {
+    int64_t ops;
+    double ns;
+};
+
+std::string key(const std::string& op, int64_t n) {
+    return op + "/" + std::to_string(n);
+}
+
+// Читает строки результатов, которые пишет write_json; в файлах без
+// поля ops оно считается равным n
+std::map<std::string, Baseline> read_baseline(const char* path) {
+    std::map<std::string, Baseline> baseline;
+    FILE* f = std::fopen(path, "r");
+    if (!f) {
+        std::perror(path);
+        std::exit(2);
+    }
+    char line[512];
+    while (std::fgets(line, sizeof(line), f)) {
+        char op[64];
+        long long n = 0;
+        long long ops = 0;
+        double ns = 0;
+        if (std::sscanf(line, " {\"op\": \"%63[^\"]\", \"n\": %lld, \"ops\": %lld, \"dynamic_array_ns\": %lf",
+                        op, &n, &ops, &ns) == 4)
+            baseline[key(op, n)] = Baseline{ops, ns};
+        else if (std::sscanf(line, " {\"op\": \"%63[^\"]\", \"n\": %lld, \"dynamic_array_ns\": %lf", op, &n, &ns) == 3)
+            baseline[key(op, n)] = Baseline{n, ns};
+    }
+    std::fclose(f);
+    return baseline;
+}
+
+void write_json(const char* path, const std::vector<Row>& rows) {
+    FILE* f = std::fopen(path, "w");
+    if (!f) {
+        std::perror(path);
+        std::exit(2);
+    }
+    std::fprintf(f, "{\n  \"benchmark\": \"bench_dynamic_array\",\n  \"unit\": \"ns per element or operation\",\n  \"results\": [\n");
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const Row& r = rows[i];
+        std::fprintf(f,
+                     "    {\"op\": \"%s\", \"n\": %lld, \"ops\": %lld, \"dynamic_array_ns\": %.4f, \"vector_ns\": %.4f, "
+                     "\"ratio\": %.3f, \"dynamic_array_allocs\": %lld, \"vector_allocs\": %lld}%s\n",
+                     r.op.c_str(), static_cast<long long>(r.n), static_cast<long long>(r.ops),
+                     r.dynamic_array_ns, r.vector_ns,
+                     r.dynamic_array_ns / r.vector_ns, static_cast<long long>(r.dynamic_array_allocs),
+                     static_cast<long long>(r.vector_allocs), i + 1 < rows.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    std::fclose(f);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int64_t max_n = 1000000000LL;
+    const char* json_path = nullptr;
+    const char* baseline_path = nullptr;
+    double threshold = 10.0;
+    for (int i = 1; i < argc; ++i) {
+        bool has_value = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--max") && has_value)
+            max_n = std::atoll(argv[++i]);
+        else if (!std::strcmp(argv[i], "--json") && has_value)
+            json_path = argv[++i];
+        else if (!std::strcmp(argv[i], "--baseline") && has_value)
+            baseline_path = argv[++i];
+        else if (!std::strcmp(argv[i], "--threshold") && has_value)
+            threshold = std::atof(argv[++i]);
+        else {
+            std::fprintf(stderr, "usage: %s [--max N] [--json out.json] [--baseline old.json] [--threshold P]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // Исходный массив и его копия должны поместиться в память с запасом
+    double memory_bytes = static_cast<double>(sysconf(_SC_PHYS_PAGES)) * static_cast<double>(sysconf(_SC_PAGESIZE));
+
+    const char* ops[] = {
+        "push_back", "push_back_reserved", "random_access", "iterate", "copy", "resize",
+        "insert_front", "insert_middle", "insert_back", "erase_front", "erase_middle", "erase_back",
+    };
+
+    std::vector<Row> rows;
+    std::printf("%-20s %12s %12s %12s %7s %10s %10s\n", "op", "n", "DA ns", "vector ns", "ratio", "DA allocs", "vec allocs");
+    for (int64_t n = 10; n <= max_n; n *= 10) {
+        if (3.0 * static_cast<double>(n) * sizeof(int) > 0.8 * memory_bytes) {
+            std::printf("n = %lld skipped: not enough memory\n", static_cast<long long>(n));
+            continue;
+        }
+        for (const char* op : ops) {
+            Result da = best<DynamicArray>(op, n);
+            Result vec = best<std::vector<int>>(op, n);
+            Row r{op, n, da.ops, da.ns, vec.ns, da.allocations, vec.allocations};
+            std::printf("%-20s %12lld %12.3f %12.3f %7.2f %10lld %10lld\n", r.op.c_str(), static_cast<long long>(n),
+                        r.dynamic_array_ns, r.vector_ns, r.dynamic_array_ns / r.vector_ns,
+                        static_cast<long long>(r.dynamic_array_allocs), static_cast<long long>(r.vector_allocs));
+            std::fflush(stdout);
+            rows.push_back(r);
+        }
+    }
+
+    if (json_path)
+        write_json(json_path, rows);
+
+    if (!baseline_path)
+        return 0;
+    std::map<std::string, Baseline> baseline = read_baseline(baseline_path);
+    int regressions = 0;
+    for (const Row& r : rows) {
+        auto it = baseline.find(key(r.op, r.n));
+        if (it == baseline.end() || it->second.ns * static_cast<double>(it->second.ops) < 1000.0)
+            continue;
+        double change = (r.dynamic_array_ns / it->second.ns - 1.0) * 100.0;
+        if (change > threshold) {
+            std::printf("REGRESSION %s n=%lld: %.3f -> %.3f ns (+%.1f%%)\n", r.op.c_str(),
+                        static_cast<long long>(r.n), it->second.ns, r.dynamic_array_ns, change);
+            ++regressions;
+        }
+    }
+    std::printf("%d regression(s) over %.1f%% against %s\n", regressions, threshold, baseline_path);
+    return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,98 @@
+// Правки вокруг курсора: DynamicArray::insert/erase против GapArray.
+//
+//   bench_gap_array [size] [edits]   (по умолчанию 10^6 элементов, 10^5 правок)
+//
+// Трассы: "typing" — набор и удаление у курсора с редкими переходами,
+// "local" — курсор гуляет в пределах нескольких сотен позиций,
+// "random" — каждая правка в случайном месте (худший случай для разрыва).
+
+#include "dynamic_array.hpp"
+#include "gap_array.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Edit {
+    int64_t position;
+    bool insert;
+};
+
+// Трасса строится заранее, чтобы оба контейнера получили одинаковые правки
+std::vector<Edit> make_trace(int64_t size, int64_t edits, int jump_per_mille, int64_t walk) {
+    std::mt19937_64 gen(42);
+    std::vector<Edit> trace;
+    trace.reserve(static_cast<size_t>(edits));
+    int64_t cursor = size / 2;
+    for (int64_t i = 0; i < edits; ++i) {
+        if (static_cast<int>(gen() % 1000) < jump_per_mille) {
+            cursor = static_cast<int64_t>(gen() % static_cast<uint64_t>(size + 1));
+        } else if (walk > 0) {
+            cursor += static_cast<int64_t>(gen() % static_cast<uint64_t>(2 * walk + 1)) - walk;
+        }
+        cursor = std::max<int64_t>(1, std::min(cursor, size));
+        bool insert = gen() % 3 != 0;
+        if (insert) {
+            trace.push_back({cursor, true});
+            ++cursor;
+            ++size;
+        } else {
+            --cursor;
+            trace.push_back({cursor, false});
+            --size;
+        }
+    }
+    return trace;
+}
+
+template <typename Array>
+double replay(Array& arr, const std::vector<Edit>& trace) {
+    auto start = std::chrono::steady_clock::now();
+    for (const Edit& edit : trace) {
+        if (edit.insert)
+            arr.insert(edit.position, static_cast<int>(edit.position));
+        else
+            arr.erase(edit.position);
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int64_t size = argc > 1 ? std::atoll(argv[1]) : 1000000LL;
+    int64_t edits = argc > 2 ? std::atoll(argv[2]) : 100000LL;
+
+    struct Scenario {
+        const char* name;
+        int jump_per_mille;
+        int64_t walk;
+    };
+    const Scenario scenarios[] = {
+        {"typing", 2, 0},
+        {"local", 0, 300},
+        {"random", 1000, 0},
+    };
+
+    std::printf("size = %lld, edits = %lld\n", static_cast<long long>(size), static_cast<long long>(edits));
+    std::printf("%-8s %14s %14s %8s\n", "trace", "DynamicArray, s", "GapArray, s", "speedup");
+    for (const Scenario& scenario : scenarios) {
+        // Случайные правки на DynamicArray идут медленно, их меньше
+        int64_t count = scenario.jump_per_mille == 1000 ? edits / 100 : edits;
+        auto trace = make_trace(size, count, scenario.jump_per_mille, scenario.walk);
+
+        DynamicArray plain(size);
+        GapArray<int> gap(size);
+        double plain_time = replay(plain, trace);
+        double gap_time = replay(gap, trace);
+
+        bool same = plain.Size() == gap.Size() && std::equal(plain.begin(), plain.end(), gap.begin());
+        std::printf("%-8s %14.3f %14.3f %8.1f%s\n", scenario.name, plain_time, gap_time,
+                    plain_time / gap_time, same ? "" : "  MISMATCH");
+    }
+    return 0;
+}
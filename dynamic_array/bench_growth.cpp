@@ -0,0 +1,75 @@
+// Рост массива push_back'ами до N элементов: время и пиковый RSS.
+// Каждый вариант запускается в отдельном дочернем процессе, чтобы
+// ru_maxrss относился только к нему.
+//
+//   bench_growth [N]   (по умолчанию N = 10^9)
+
+#include "dynamic_array.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+// Прежняя схема роста: новый буфер, std::copy, delete[] старого
+void grow_copying(int64_t count) {
+    int64_t size = 0;
+    int64_t capacity = 0;
+    int* data = nullptr;
+    for (int64_t i = 0; i < count; ++i) {
+        if (size == capacity) {
+            int64_t new_capacity = std::max(int64_t(1), capacity * 2);
+            int* new_data = new int[new_capacity];
+            std::copy(data, data + size, new_data);
+            delete[] data;
+            data = new_data;
+            capacity = new_capacity;
+        }
+        data[size++] = static_cast<int>(i);
+    }
+    volatile int sink = data[count / 2];
+    (void)sink;
+    delete[] data;
+}
+
+void grow_dynamic_array(int64_t count) {
+    DynamicArray arr;
+    for (int64_t i = 0; i < count; ++i) {
+        arr.push_back(static_cast<int>(i));
+    }
+    volatile int sink = arr[count / 2];
+    (void)sink;
+}
+
+void run(const char* name, void (*body)(int64_t), int64_t count) {
+    auto start = std::chrono::steady_clock::now();
+    pid_t pid = fork();
+    if (pid == 0) {
+        body(count);
+        _exit(0);
+    }
+    int status = 0;
+    rusage usage{};
+    wait4(pid, &status, 0, &usage);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        std::printf("%-16s failed (out of memory?)\n", name);
+        return;
+    }
+    std::printf("%-16s %10.3f s %12.1f MiB peak RSS\n", name, seconds, usage.ru_maxrss / 1024.0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int64_t count = argc > 1 ? std::atoll(argv[1]) : 1000000000LL;
+    std::printf("push_back x %lld (%.1f MiB of data)\n",
+                static_cast<long long>(count), count * sizeof(int) / 1048576.0);
+    run("new+copy", grow_copying, count);
+    run("DynamicArray", grow_dynamic_array, count);
+    return 0;
+}
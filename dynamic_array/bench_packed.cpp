@@ -0,0 +1,61 @@
+// Последовательный просмотр сжатого массива против обычного.
+//
+//   bench_packed [N]   (по умолчанию N = 2*10^8)
+
+#include "packed_int_array.hpp"
+#include "dynamic_array_simd.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+namespace {
+
+template <typename F>
+double measure(F body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void run(const char* name, const DynamicArray& source) {
+    PackedIntArray packed(source);
+    int64_t plain_bytes = source.Size() * static_cast<int64_t>(sizeof(int));
+
+    int64_t plain_sum = 0;
+    int64_t packed_sum = 0;
+    double plain = measure([&] { plain_sum = simd::sum(source); });
+    double compressed = measure([&] { packed_sum = packed.sum(); });
+
+    std::printf("%-12s %8.2fx %10.3f %10.3f %8.2f%s\n", name,
+                static_cast<double>(plain_bytes) / static_cast<double>(packed.memory_bytes()),
+                plain, compressed, plain / compressed, plain_sum == packed_sum ? "" : "  MISMATCH");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int64_t n = argc > 1 ? std::atoll(argv[1]) : 200000000LL;
+    std::mt19937 gen(1);
+
+    std::printf("N = %lld\n", static_cast<long long>(n));
+    std::printf("%-12s %9s %10s %10s %8s\n", "data", "ratio", "plain, s", "packed, s", "speedup");
+
+    DynamicArray data(n);
+    int64_t t = 1700000000;
+    for (int64_t i = 0; i < n; ++i) {
+        t += gen() % 16;
+        data[i] = static_cast<int>(t);
+    }
+    run("timestamps", data);
+
+    for (int64_t i = 0; i < n; ++i)
+        data[i] = static_cast<int>(gen() % 100000);
+    run("ids < 1e5", data);
+
+    for (int64_t i = 0; i < n; ++i)
+        data[i] = static_cast<int>(gen());
+    run("random", data);
+    return 0;
+}
@@ -0,0 +1,55 @@
+// Масштабирование параллельных алгоритмов по числу потоков.
+//
+//   bench_parallel [N] [max_threads]   (по умолчанию N = 5*10^8, до 32 потоков)
+
+#include "parallel_algorithms.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+namespace {
+
+template <typename F>
+double measure(F body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int64_t n = argc > 1 ? std::atoll(argv[1]) : 500000000LL;
+    unsigned max_threads = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 32;
+
+    DynamicArray source(n);
+    std::mt19937 gen(1);
+    for (int64_t i = 0; i < n; ++i)
+        source[i] = static_cast<int>(gen());
+
+    DynamicArray work;
+    double baseline = measure([&] {
+        work = source;
+        std::sort(work.begin(), work.end());
+    });
+    std::printf("N = %lld, std::sort (1 thread): %.3f s\n", static_cast<long long>(n), baseline);
+    std::printf("%8s %12s %12s %12s %12s\n", "threads", "radix_sort", "merge_sort", "transform", "scan");
+
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+        parallel::ThreadPool pool(threads);
+
+        work = source;
+        double radix = measure([&] { parallel::sort(work, pool); });
+        work = source;
+        double merge = measure([&] { parallel::sort(work, std::less<int>(), pool); });
+        double transform = measure([&] {
+            parallel::transform(source, work, [](int v) { return v * 3 + 1; }, pool);
+        });
+        double scan = measure([&] { parallel::inclusive_scan(work, pool); });
+
+        std::printf("%8u %11.3fs %11.3fs %11.3fs %11.3fs\n", threads, radix, merge, transform, scan);
+    }
+    return 0;
+}
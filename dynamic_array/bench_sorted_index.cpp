@@ -0,0 +1,68 @@
+// Поиск в большом отсортированном массиве: std::lower_bound против
+// SortedIndex (по одному ключу и пакетами).
+//
+//   bench_sorted_index [N] [queries]   (по умолчанию N = 10^8, 10^7 запросов)
+
+#include "sorted_index.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+template <typename F>
+double measure(F body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int64_t n = argc > 1 ? std::atoll(argv[1]) : 100000000LL;
+    int64_t q = argc > 2 ? std::atoll(argv[2]) : 10000000LL;
+
+    std::mt19937 gen(1);
+    DynamicArray keys(n);
+    for (int64_t i = 0; i < n; ++i)
+        keys[i] = static_cast<int>(gen());
+    std::sort(keys.begin(), keys.end());
+    SortedIndex index(keys);
+
+    std::vector<int> queries(static_cast<size_t>(q));
+    for (auto& key : queries)
+        key = static_cast<int>(gen());
+    std::vector<int64_t> ranks(queries.size());
+
+    int64_t check_std = 0;
+    int64_t check_index = 0;
+    double baseline = measure([&] {
+        for (int key : queries)
+            check_std += std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+    });
+    double single = measure([&] {
+        for (int key : queries)
+            check_index += index.lower_bound(key);
+    });
+    double batch = measure([&] { index.lower_bound(queries.data(), q, ranks.data()); });
+
+    int64_t check_batch = 0;
+    for (int64_t r : ranks)
+        check_batch += r;
+
+    std::printf("N = %lld, queries = %lld\n", static_cast<long long>(n), static_cast<long long>(q));
+    std::printf("%-20s %10s %10s\n", "", "ns/query", "speedup");
+    std::printf("%-20s %10.1f %10.2f\n", "std::lower_bound", baseline * 1e9 / q, 1.0);
+    std::printf("%-20s %10.1f %10.2f\n", "SortedIndex", single * 1e9 / q, baseline / single);
+    std::printf("%-20s %10.1f %10.2f\n", "SortedIndex batch", batch * 1e9 / q, baseline / batch);
+    if (check_std != check_index || check_std != check_batch) {
+        std::printf("MISMATCH\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,200 @@
+#ifndef CONCURRENT_APPEND_ARRAY_HPP
+#define CONCURRENT_APPEND_ARRAY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+// Массив только с добавлением для многих потоков без блокировок.
+// push_back занимает слот атомарным fetch_add, а хранилище состоит из
+// корзин растущего размера (32, 64, 128, ...), которые никогда не
+// перемещаются: добавленные элементы остаются на месте, пока жив массив.
+// Каждый слот помечается готовым после записи, поэтому читатели могут
+// параллельно обходить уже опубликованные элементы. Корзина публикуется
+// одним CAS, поэтому ни один поток не ждёт другого, даже застрявшего в new.
+template <typename T>
+class ConcurrentAppendArray {
+    static constexpr int kFirstShift = 5;
+    static constexpr int kMaxBuckets = 48;
+
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+        std::atomic<bool> ready{false};
+
+        T* value() { return std::launder(reinterpret_cast<T*>(storage)); }
+        const T* value() const { return std::launder(reinterpret_cast<const T*>(storage)); }
+    };
+
+public:
+    ConcurrentAppendArray() {
+        for (auto& bucket : buckets_) {
+            bucket.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentAppendArray(const ConcurrentAppendArray&) = delete;
+    ConcurrentAppendArray& operator=(const ConcurrentAppendArray&) = delete;
+
+    // Вызывается, когда другие потоки уже не обращаются к массиву
+    ~ConcurrentAppendArray() {
+        for (int b = 0; b < kMaxBuckets; ++b) {
+            Slot* slots = published(b);
+            if (!slots) {
+                continue;
+            }
+            for (int64_t i = 0; i < bucket_size(b); ++i) {
+                if (slots[i].ready.load(std::memory_order_relaxed)) {
+                    slots[i].value()->~T();
+                }
+            }
+            delete[] slots;
+        }
+    }
+
+    // Индекс добавленного элемента
+    int64_t push_back(const T& value) { return emplace_back(value); }
+    int64_t push_back(T&& value) { return emplace_back(std::move(value)); }
+
+    template <typename... Args>
+    int64_t emplace_back(Args&&... args) {
+        int64_t index = size_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= kCapacity) {
+            // Слот не будет опубликован: вернуть счётчик, Size() его и так не показывает
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            throw std::length_error("ConcurrentAppendArray is full");
+        }
+        Slot& slot = slot_for(index, true);
+        // Владелец первого слота корзины b заранее выделяет корзину b + 1,
+        // пока его элемент ещё не опубликован. Без исключений: при нехватке
+        // памяти корзину позже выделит тот, кому она понадобится
+        int b = bucket_index(index);
+        if (index == bucket_first(b) && b + 1 < kMaxBuckets) {
+            try_preallocate(b + 1);
+        }
+        new (slot.storage) T(std::forward<Args>(args)...);
+        slot.ready.store(true, std::memory_order_release);
+        return index;
+    }
+
+    // Заранее выделяет корзины под capacity элементов
+    void reserve(int64_t capacity) {
+        if (capacity < 0) {
+            throw std::invalid_argument("Capacity cannot be negative");
+        }
+        for (int b = 0; b < kMaxBuckets && bucket_first(b) < capacity; ++b) {
+            bucket(b);
+        }
+    }
+
+    // Число занятых слотов; часть из них может ещё заполняться
+    int64_t Size() const { return std::min(size_.load(std::memory_order_acquire), kCapacity); }
+    bool empty() const { return Size() == 0; }
+
+    bool is_published(int64_t i) const {
+        if (i < 0 || i >= Size()) {
+            return false;
+        }
+        const Slot* slot = slot_at(i);
+        return slot && slot->ready.load(std::memory_order_acquire);
+    }
+
+    // Доступ без проверок: элемент должен быть опубликован
+    T& operator[](int64_t i) { return *slot_for(i, false).value(); }
+    const T& operator[](int64_t i) const { return *slot_at(i)->value(); }
+
+    const T& at(int64_t i) const {
+        if (!is_published(i)) {
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[i];
+    }
+
+    // Обходит опубликованные элементы по возрастанию индекса: fn(index, value).
+    // Слоты, занятые, но ещё не заполненные, пропускаются.
+    template <typename F>
+    void for_each(F fn) const {
+        int64_t size = Size();
+        for (int b = 0; b < kMaxBuckets && bucket_first(b) < size; ++b) {
+            const Slot* slots = published(b);
+            if (!slots) {
+                continue;
+            }
+            int64_t first = bucket_first(b);
+            int64_t count = std::min(bucket_size(b), size - first);
+            for (int64_t k = 0; k < count; ++k) {
+                if (slots[k].ready.load(std::memory_order_acquire)) {
+                    fn(first + k, *slots[k].value());
+                }
+            }
+        }
+    }
+
+private:
+    static constexpr int64_t kFirst = int64_t(1) << kFirstShift;
+    static constexpr int64_t kCapacity = (kFirst << kMaxBuckets) - kFirst;   //!< bucket_first(kMaxBuckets)
+
+    // Корзина b хранит индексы [kFirst * (2^b - 1), kFirst * (2^(b+1) - 1))
+    static int64_t bucket_size(int b) { return kFirst << b; }
+    static int64_t bucket_start(int b) { return kFirst << b; }
+    static int64_t bucket_first(int b) { return bucket_start(b) - kFirst; }
+
+    static int bucket_index(int64_t i) {
+        return 63 - __builtin_clzll(static_cast<uint64_t>(i + kFirst)) - kFirstShift;
+    }
+
+    // Корзина b или nullptr, пока она не выделена
+    Slot* published(int b) const {
+        return buckets_[b].load(std::memory_order_acquire);
+    }
+
+    // Без блокировок: каждый претендент выделяет корзину, CAS из nullptr
+    // публикует одну, проигравшие освобождают свои. Гонка редка: корзину
+    // обычно заранее выделяет try_preallocate
+    Slot* bucket(int b) {
+        Slot* slots = published(b);
+        if (slots) {
+            return slots;
+        }
+        Slot* fresh = new Slot[bucket_size(b)];
+        if (buckets_[b].compare_exchange_strong(slots, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return fresh;
+        }
+        delete[] fresh;
+        return slots;
+    }
+
+    // Как bucket(), но без исключений: при нехватке памяти корзину позже
+    // выделит тот, кому она понадобится
+    void try_preallocate(int b) noexcept {
+        if (published(b)) {
+            return;
+        }
+        Slot* fresh = new (std::nothrow) Slot[bucket_size(b)];
+        Slot* expected = nullptr;
+        if (fresh && !buckets_[b].compare_exchange_strong(expected, fresh, std::memory_order_acq_rel,
+                                                          std::memory_order_acquire)) {
+            delete[] fresh;
+        }
+    }
+
+    Slot& slot_for(int64_t i, bool allocate) {
+        int b = bucket_index(i);
+        Slot* slots = allocate ? bucket(b) : published(b);
+        return slots[i + kFirst - bucket_start(b)];
+    }
+
+    // Слот индекса i или nullptr, если корзина ещё не выделена
+    const Slot* slot_at(int64_t i) const {
+        int b = bucket_index(i);
+        const Slot* slots = b < kMaxBuckets ? published(b) : nullptr;
+        return slots ? slots + (i + kFirst - bucket_start(b)) : nullptr;
+    }
+
+    std::atomic<int64_t> size_{0};            //!< число выданных слотов
+    std::atomic<Slot*> buckets_[kMaxBuckets];  //!< корзины; nullptr, пока не нужны
+};
+
+#endif // CONCURRENT_APPEND_ARRAY_HPP
@@ -0,0 +1,148 @@
+#ifndef COW_DYNAMIC_ARRAY_HPP
+#define COW_DYNAMIC_ARRAY_HPP
+
+#include <initializer_list>
+#include <cstdint>
+#include <atomic>
+#include <utility>
+#include "array_view.hpp"
+#include "dynamic_array.hpp"
+
+// DynamicArray с копированием при записи: копии разделяют один буфер со
+// счётчиком ссылок, а собственная копия создаётся при первом изменении.
+// Снимок для читателей в других потоках стоит O(1). Ссылки и указатели,
+// полученные через неконстантный доступ, действительны до следующего
+// копирования объекта.
+class CowDynamicArray {
+public:
+    CowDynamicArray() = default;
+
+    CowDynamicArray(int64_t size, int value = 0)
+        : data_(new Shared{DynamicArray(size, value)}) {}
+
+    CowDynamicArray(const std::initializer_list<int>& list)
+        : data_(new Shared{DynamicArray(list)}) {}
+
+    // Забирает буфер массива без копирования
+    explicit CowDynamicArray(DynamicArray&& arr)
+        : data_(new Shared{std::move(arr)}) {}
+
+    explicit CowDynamicArray(const DynamicArray& arr)
+        : data_(new Shared{arr}) {}
+
+    CowDynamicArray(const CowDynamicArray& other) noexcept
+        : data_(other.data_) {
+        if (data_) {
+            data_->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    CowDynamicArray(CowDynamicArray&& other) noexcept
+        : data_(other.data_) {
+        other.data_ = nullptr;
+    }
+
+    CowDynamicArray& operator=(const CowDynamicArray& rhs) noexcept {
+        CowDynamicArray tmp(rhs);
+        swap(tmp);
+        return *this;
+    }
+
+    CowDynamicArray& operator=(CowDynamicArray&& rhs) noexcept {
+        CowDynamicArray tmp(std::move(rhs));
+        swap(tmp);
+        return *this;
+    }
+
+    ~CowDynamicArray() {
+        release();
+    }
+
+    // Снимок, разделяющий буфер с этим массивом
+    CowDynamicArray snapshot() const { return *this; }
+
+    bool is_shared() const { return use_count() > 1; }
+
+    long use_count() const {
+        return data_ ? data_->refs.load(std::memory_order_acquire) : 0;
+    }
+
+    // Содержимое только для чтения, например для функций simd::. Константный
+    // DynamicArray сюда не годится: его at() и operator[] отдают int& в
+    // разделяемый буфер
+    ArrayView get() const { return ArrayView(array()); }
+
+    int64_t Size() const { return array().Size(); }
+    int64_t Capacity() const { return array().Capacity(); }
+    bool empty() const { return array().empty(); }
+
+    void push_back(int value) { mutable_array().push_back(value); }
+    void pop_back() { mutable_array().pop_back(); }
+    void clear() { mutable_array().clear(); }
+    void erase(int64_t index) { mutable_array().erase(index); }
+    void erase(int64_t first_index, int64_t last_index) { mutable_array().erase(first_index, last_index); }
+    void resize(int64_t new_size) { mutable_array().resize(new_size); }
+    void reserve(int64_t new_capacity) { mutable_array().reserve(new_capacity); }
+    void assign(int64_t new_size, int value) { mutable_array().assign(new_size, value); }
+    void insert(int64_t index, int value) { mutable_array().insert(index, value); }
+    void append(const int* first, const int* last) { mutable_array().append(first, last); }
+
+    void swap(CowDynamicArray& other) noexcept { std::swap(data_, other.data_); }
+
+    int* begin() { return mutable_array().begin(); }
+    int* end() { return mutable_array().end(); }
+    const int* begin() const { return array().begin(); }
+    const int* end() const { return array().end(); }
+
+    int& at(int64_t i) { return mutable_array().at(i); }
+    const int& at(int64_t i) const { return array().at(i); }
+
+    int& operator[](int64_t i) { return mutable_array()[i]; }
+    const int& operator[](int64_t i) const { return array()[i]; }
+
+    bool operator==(const CowDynamicArray& rhs) const {
+        return data_ == rhs.data_ || array() == rhs.array();
+    }
+
+    bool operator!=(const CowDynamicArray& rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    struct Shared {
+        DynamicArray array;
+        std::atomic<long> refs{1};
+    };
+
+    static const DynamicArray& empty_array() {
+        static const DynamicArray empty;
+        return empty;
+    }
+
+    const DynamicArray& array() const { return data_ ? data_->array : empty_array(); }
+
+    // Отделяет собственную копию буфера, если он разделяется с другими.
+    // acquire-чтение счётчика упорядочивает запись после чтений владельцев,
+    // уже отпустивших буфер.
+    DynamicArray& mutable_array() {
+        if (!data_) {
+            data_ = new Shared{DynamicArray()};
+        } else if (is_shared()) {
+            Shared* own = new Shared{data_->array};
+            release();
+            data_ = own;
+        }
+        return data_->array;
+    }
+
+    void release() noexcept {
+        if (data_ && data_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete data_;
+        }
+        data_ = nullptr;
+    }
+
+    Shared* data_ = nullptr;  //!< общий буфер со счётчиком ссылок; nullptr у пустого массива
+};
+
+#endif // COW_DYNAMIC_ARRAY_HPP
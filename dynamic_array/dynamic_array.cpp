@@ -1,57 +1,367 @@
 #include "dynamic_array.hpp"
+#include "dynamic_array_simd.hpp"
+#include "alloc_tracking.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+size_t page_size() {
+#if defined(__linux__)
+    static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return page;
+#else
+    return 4096;
+#endif
+}
+
+#if defined(__linux__)
+// Буферы от 64 МиБ отображаются через mmap, чтобы mremap мог расширять их без копирования
+constexpr size_t kMapThresholdBytes = size_t(64) << 20;
+
+size_t mapped_length(size_t bytes) {
+    return (bytes + page_size() - 1) / page_size() * page_size();
+}
+
+bool is_mapped(size_t bytes) {
+    return bytes >= kMapThresholdBytes;
+}
+#endif
+
+size_t byte_count(int64_t capacity) {
+    return static_cast<size_t>(capacity) * sizeof(int);
+}
+
+// Просит ядро отображать буфер страницами по 2 МиБ; без THP подсказка игнорируется
+void advise_huge_pages(void* p, size_t bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    madvise(p, mapped_length(bytes), MADV_HUGEPAGE);
+#else
+    (void)p;
+    (void)bytes;
+#endif
+}
+
+bool over_aligned(size_t alignment) {
+    return alignment > alignof(std::max_align_t);
+}
+
+// Отображённые буферы выровнены по странице, поэтому alignment нужен только malloc-пути
+int* allocate_storage(int64_t capacity, size_t alignment, bool huge) {
+    if (capacity <= 0) {
+        return nullptr;
+    }
+    size_t bytes = byte_count(capacity);
+#if defined(__linux__)
+    if (is_mapped(bytes)) {
+        void* p = mmap(nullptr, mapped_length(bytes), PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        if (huge) {
+            advise_huge_pages(p, bytes);
+        }
+        return static_cast<int*>(p);
+    }
+#else
+    (void)huge;
+#endif
+    // aligned_alloc требует размер, кратный выравниванию
+    void* p = over_aligned(alignment)
+        ? std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment)
+        : std::malloc(bytes);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return static_cast<int*>(p);
+}
+
+int* resize_storage(int* data, int64_t size, int64_t capacity, int64_t new_capacity,
+                    size_t alignment, bool huge) {
+    size_t old_bytes = byte_count(capacity);
+    size_t new_bytes = byte_count(new_capacity);
+    if (data == nullptr) {
+        return allocate_storage(new_capacity, alignment, huge);
+    }
+#if defined(__linux__)
+    if (is_mapped(old_bytes) && is_mapped(new_bytes)) {
+        void* p = mremap(data, mapped_length(old_bytes), mapped_length(new_bytes), MREMAP_MAYMOVE);
+        if (p == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        if (huge) {
+            advise_huge_pages(p, new_bytes);
+        }
+        return static_cast<int*>(p);
+    }
+    bool move = is_mapped(old_bytes) || is_mapped(new_bytes) || over_aligned(alignment);
+#else
+    (void)old_bytes;
+    bool move = over_aligned(alignment);
+#endif
+    // realloc не сохраняет выравнивание больше стандартного
+    if (move) {
+        int* new_data = allocate_storage(new_capacity, alignment, huge);
+        std::memcpy(new_data, data, byte_count(std::min(size, new_capacity)));
+        DynamicArray::deallocate(data, capacity);
+        return new_data;
+    }
+    void* p = std::realloc(data, new_bytes);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return static_cast<int*>(p);
+}
+
+} // namespace
+
+int* DynamicArray::allocate(int64_t capacity) {
+    return allocate_storage(capacity, 0, false);
+}
+
+void DynamicArray::deallocate(int* ptr, int64_t capacity) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+#if defined(__linux__)
+    size_t bytes = byte_count(capacity);
+    if (is_mapped(bytes)) {
+        munmap(ptr, mapped_length(bytes));
+        return;
+    }
+#else
+    (void)capacity;
+#endif
+    std::free(ptr);
+}
+
+void DynamicArray::reallocate(int64_t new_capacity) {
+    // Учёт только после успешного переезда: при bad_alloc буфер прежний
+    bool moved = data != nullptr;
+    if (resource == nullptr) {
+        // realloc/mremap: учитываем как освобождение старого буфера и выделение нового
+        int* new_data = resize_storage(data, size, capacity, new_capacity, static_cast<size_t>(align), huge);
+        if (data != nullptr) {
+            ALLOC_TRACK_FREE("DynamicArray", byte_count(capacity));
+        }
+        if (new_data != nullptr) {
+            ALLOC_TRACK_ALLOC("DynamicArray", byte_count(new_capacity));
+        }
+        data = new_data;
+    } else {
+        int* new_data = acquire(new_capacity);
+        if (data != nullptr) {
+            std::memcpy(new_data, data, byte_count(std::min(size, new_capacity)));
+        }
+        dispose(data, capacity);
+        data = new_data;
+    }
+    if (moved) {
+        ALLOC_TRACK_REALLOC("DynamicArray");
+    }
+    capacity = new_capacity;
+}
+
+int* DynamicArray::acquire(int64_t new_capacity) const {
+    int* ptr = nullptr;
+    if (resource == nullptr) {
+        ptr = allocate_storage(new_capacity, static_cast<size_t>(align), huge);
+    } else if (new_capacity > 0) {
+        ptr = static_cast<int*>(resource->allocate(byte_count(new_capacity), resource_alignment()));
+    }
+    if (ptr != nullptr) {
+        ALLOC_TRACK_ALLOC("DynamicArray", byte_count(new_capacity));
+    }
+    return ptr;
+}
+
+size_t DynamicArray::resource_alignment() const {
+    return std::max(alignof(int), static_cast<size_t>(align));
+}
+
+void DynamicArray::dispose(int* ptr, int64_t old_capacity) const noexcept {
+    if (ptr != nullptr) {
+        ALLOC_TRACK_FREE("DynamicArray", byte_count(old_capacity));
+    }
+    if (resource == nullptr) {
+        deallocate(ptr, old_capacity);
+    } else if (ptr != nullptr) {
+        resource->deallocate(ptr, byte_count(old_capacity), resource_alignment());
+    }
+}
+
+int64_t DynamicArray::next_capacity(int64_t required) const {
+    int64_t grown = capacity;
+    switch (policy) {
+    case GrowthPolicy::Double:
+        grown = capacity * 2;
+        break;
+    case GrowthPolicy::OneAndHalf:
+        grown = capacity + capacity / 2;
+        break;
+    case GrowthPolicy::PageRounded: {
+        int64_t per_page = static_cast<int64_t>(page_size() / sizeof(int));
+        grown = std::max(capacity * 2, required);
+        grown = (grown + per_page - 1) / per_page * per_page;
+        break;
+    }
+    }
+    return std::max({int64_t(1), grown, required});
+}
 
 DynamicArray::DynamicArray(int64_t size, int value)
     : size(size), capacity(size) {
     if (capacity > 0) {
-        data = new int[capacity];
+        data = acquire(capacity);
         std::fill(data, data + size, value);
     } else {
         data = nullptr;
     }
 }
 
+DynamicArray::DynamicArray(int64_t size, int value, std::pmr::memory_resource* resource)
+    : size(size), capacity(size), resource(resource) {
+    if (size < 0) {
+        throw std::invalid_argument("Size cannot be negative");
+    }
+    data = acquire(capacity);
+    std::fill(data, data + size, value);
+}
+
+DynamicArray::DynamicArray(int64_t size, int value, Alignment alignment, bool huge_pages)
+    : size(size), capacity(size), align(alignment), huge(huge_pages) {
+    if (size < 0) {
+        throw std::invalid_argument("Size cannot be negative");
+    }
+    data = acquire(capacity);
+    simd::fill(data, size, value);
+}
+
 DynamicArray::DynamicArray(const std::initializer_list<int>& list)
     : size(list.size()), capacity(list.size()) {
-    data = new int[capacity];
+    data = acquire(capacity);
     std::copy(list.begin(), list.end(), data);
 }
 
 DynamicArray::DynamicArray(const DynamicArray& other)
-    : size(other.size), capacity(other.capacity) {
-    data = new int[capacity];
+    : size(other.size), capacity(other.capacity), policy(other.policy),
+      align(other.align), huge(other.huge) {
+    data = acquire(capacity);
     std::copy(other.data, other.data + size, data);
+    ALLOC_TRACK_COPY("DynamicArray", byte_count(size));
 }
 
+DynamicArray::DynamicArray(const DynamicArray& other, std::pmr::memory_resource* resource)
+    : size(other.size), capacity(other.capacity), policy(other.policy), resource(resource),
+      align(other.align), huge(other.huge) {
+    data = acquire(capacity);
+    std::copy(other.data, other.data + size, data);
+    ALLOC_TRACK_COPY("DynamicArray", byte_count(size));
+}
+
+// Массив сохраняет свой ресурс и параметры хранения, копируются только элементы
 DynamicArray& DynamicArray::operator=(const DynamicArray& rhs) {
     if (this != &rhs) {
-        int* new_data = new int[rhs.capacity];
+        int* new_data = acquire(rhs.capacity);
         std::copy(rhs.data, rhs.data + rhs.size, new_data);
-        delete[] data;
+        ALLOC_TRACK_COPY("DynamicArray", byte_count(rhs.size));
+        dispose(data, capacity);
         data = new_data;
         size = rhs.size;
         capacity = rhs.capacity;
+        policy = rhs.policy;
+    }
+    return *this;
+}
+
+DynamicArray::DynamicArray(DynamicArray&& other) noexcept
+    : size(other.size), capacity(other.capacity), data(other.data), policy(other.policy), resource(other.resource),
+      align(other.align), huge(other.huge) {
+    other.size = 0;
+    other.capacity = 0;
+    other.data = nullptr;
+}
+
+DynamicArray& DynamicArray::operator=(DynamicArray&& rhs) noexcept {
+    if (this != &rhs) {
+        dispose(data, capacity);
+        data = rhs.data;
+        size = rhs.size;
+        capacity = rhs.capacity;
+        policy = rhs.policy;
+        resource = rhs.resource;
+        align = rhs.align;
+        huge = rhs.huge;
+        rhs.data = nullptr;
+        rhs.size = 0;
+        rhs.capacity = 0;
     }
     return *this;
 }
 
 DynamicArray::~DynamicArray() {
-    delete[] data;
+    dispose(data, capacity);
 }
 
 int64_t DynamicArray::Size() const { return size; }
 int64_t DynamicArray::Capacity() const { return capacity; }
 bool DynamicArray::empty() const { return size == 0; }
 
+std::pmr::memory_resource* DynamicArray::memory_resource() const { return resource; }
+
+GrowthPolicy DynamicArray::growth_policy() const { return policy; }
+void DynamicArray::set_growth_policy(GrowthPolicy new_policy) { policy = new_policy; }
+
+Alignment DynamicArray::alignment() const { return align; }
+bool DynamicArray::huge_pages() const { return huge; }
+
+void DynamicArray::set_storage(Alignment alignment, bool huge_pages) {
+    if (alignment == align && huge_pages == huge) {
+        return;
+    }
+    DynamicArray moved(0, 0, alignment, huge_pages);
+    moved.resource = resource;
+    moved.policy = policy;
+    moved.reallocate(capacity);
+    std::copy(data, data + size, moved.data);
+    moved.size = size;
+    swap(moved);
+}
+
+void DynamicArray::reserve(int64_t new_capacity) {
+    if (new_capacity < 0) {
+        throw std::invalid_argument("Capacity cannot be negative");
+    }
+    if (new_capacity > capacity) {
+        reallocate(new_capacity);
+    }
+}
+
+void DynamicArray::shrink_to_fit() {
+    if (capacity == size) {
+        return;
+    }
+    if (size == 0) {
+        dispose(data, capacity);
+        data = nullptr;
+        capacity = 0;
+        return;
+    }
+    reallocate(size);
+}
+
 void DynamicArray::push_back(int value) {
     if (size == capacity) {
-        int64_t new_capacity = std::max(int64_t(1), capacity * 2);
-        int* new_data = new int[new_capacity];
-        if (data) {
-            std::copy(data, data + size, new_data);
-        }
-        delete[] data;
-        data = new_data;
-        capacity = new_capacity;
+        reallocate(next_capacity(size + 1));
     }
     data[size++] = value;
 }
@@ -82,32 +392,57 @@ void DynamicArray::resize(int64_t new_size) {
     }
     
     if (new_size > capacity) {
-        int* new_data = new int[new_size];
-        std::copy(data, data + size, new_data);
-        delete[] data;
-        data = new_data;
-        capacity = new_size;
+        reallocate(next_capacity(new_size));
     }
     
     // Инициализация новых элементов нулем
     if (new_size > size) {
-        std::fill(data + size, data + new_size, 0);
+        simd::fill(data + size, new_size - size, 0);
     }
     
     size = new_size;
 }
 
+void DynamicArray::resize_for_overwrite(int64_t new_size) {
+    if (new_size < 0) {
+        throw std::invalid_argument("Size cannot be negative");
+    }
+    if (new_size > capacity) {
+        int64_t new_capacity = next_capacity(new_size);
+        if (size == 0) {
+            // Сохранять нечего: новый буфер без копирования старого
+            int* new_data = acquire(new_capacity);
+            dispose(data, capacity);
+            data = new_data;
+            capacity = new_capacity;
+        } else {
+            reallocate(new_capacity);
+        }
+    }
+    size = new_size;
+}
+
+int* DynamicArray::append_uninitialized(int64_t count) {
+    if (count < 0) {
+        throw std::invalid_argument("Size cannot be negative");
+    }
+    int64_t old_size = size;
+    resize_for_overwrite(size + count);
+    return data + old_size;
+}
+
 void DynamicArray::assign(int64_t new_size, int value) {
     if (new_size < 0) {
         throw std::invalid_argument("Size cannot be negative");
     }
     
     if (new_size > capacity) {
-        delete[] data;
+        int* new_data = acquire(new_size);
+        dispose(data, capacity);
+        data = new_data;
         capacity = new_size;
-        data = new_size > 0 ? new int[capacity] : nullptr;
     }
-    std::fill(data, data + new_size, value);
+    simd::fill(data, new_size, value);
     size = new_size;
 }
 
@@ -117,31 +452,111 @@ void DynamicArray::insert(int64_t index, int value) {
     }
     
     if (size == capacity) {
-        int64_t new_capacity = std::max(int64_t(1), capacity * 2);
-        int* new_data = new int[new_capacity];
-        if (data) {
-            std::copy(data, data + index, new_data);
-            std::copy(data + index, data + size, new_data + index + 1);
-        }
-        delete[] data;
-        data = new_data;
-        capacity = new_capacity;
-    } else {
-        std::copy_backward(data + index, data + size, data + size + 1);
+        reallocate(next_capacity(size + 1));
     }
+    std::copy_backward(data + index, data + size, data + size + 1);
     
     data[index] = value;
     ++size;
 }
 
+void DynamicArray::insert(int64_t index, const int* first, const int* last) {
+    if (index < 0 || index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+    int64_t count = last - first;
+    if (count <= 0) {
+        return;
+    }
+    // std::less/greater дают полный порядок и для указателей в разные массивы
+    if (std::less<const int*>{}(first, data + size) && std::greater<const int*>{}(last, data)) {
+        // Диапазон из этого же массива: сначала копируем, реаллокация его инвалидирует
+        DynamicArray tmp;
+        tmp.reallocate(count);
+        std::copy(first, last, tmp.data);
+        insert(index, tmp.data, tmp.data + count);
+        return;
+    }
+
+    if (size + count > capacity) {
+        reallocate(next_capacity(size + count));
+    }
+    std::copy_backward(data + index, data + size, data + size + count);
+    std::copy(first, last, data + index);
+    size += count;
+}
+
+void DynamicArray::append(const int* first, const int* last) {
+    insert(size, first, last);
+}
+
+void DynamicArray::erase(int64_t first_index, int64_t last_index) {
+    if (first_index < 0 || first_index > last_index || last_index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+    std::copy(data + last_index, data + size, data + first_index);
+    size -= last_index - first_index;
+}
+
 void DynamicArray::swap(DynamicArray& other) {
     std::swap(size, other.size);
     std::swap(capacity, other.capacity);
     std::swap(data, other.data);
+    std::swap(policy, other.policy);
+    std::swap(resource, other.resource);
+    std::swap(align, other.align);
+    std::swap(huge, other.huge);
+}
+
+DynamicArray::Buffer DynamicArray::release() {
+    if (resource != nullptr) {
+        throw std::logic_error("Cannot release the buffer of an array with a memory_resource");
+    }
+    // Буфер уходит из-под учёта вместе с владением
+    if (data != nullptr) {
+        ALLOC_TRACK_FREE("DynamicArray", byte_count(capacity));
+    }
+    Buffer released{data, capacity};
+    data = nullptr;
+    size = 0;
+    capacity = 0;
+    return released;
+}
+
+void DynamicArray::adopt(int* ptr, int64_t new_size, int64_t new_capacity) {
+    if (new_size < 0 || new_size > new_capacity) {
+        throw std::invalid_argument("Size must be in [0, capacity]");
+    }
+    if (ptr == nullptr && new_capacity > 0) {
+        throw std::invalid_argument("Null buffer with non-zero capacity");
+    }
+    if (ptr == data) {
+        // Свой же буфер: меняется только размер. От ёмкости зависят способ
+        // освобождения (free или munmap), размер для ресурса и учёт выделений
+        if (new_capacity != capacity) {
+            throw std::invalid_argument("Cannot change capacity of the array's own buffer");
+        }
+        size = new_size;
+        return;
+    }
+    if (resource != nullptr) {
+        throw std::logic_error("Cannot adopt a foreign buffer into an array with a memory_resource");
+    }
+    dispose(data, capacity);
+    align = Alignment::Default;
+    huge = false;
+    if (ptr != nullptr) {
+        ALLOC_TRACK_ALLOC("DynamicArray", byte_count(new_capacity));
+    }
+    data = ptr;
+    size = new_size;
+    capacity = new_capacity;
 }
 
 int* DynamicArray::begin() { return data; }
 int* DynamicArray::end() { return data + size; }
+const int* DynamicArray::begin() const { return data; }
+const int* DynamicArray::end() const { return data + size; }
 
 int& DynamicArray::at(int64_t i) const {
     if (i < 0 || i >= size) {
@@ -154,7 +569,7 @@ int& DynamicArray::operator[](int64_t i) const { return data[i]; }
 
 bool DynamicArray::operator==(const DynamicArray& rhs) const {
     if (size != rhs.size) return false;
-    return std::equal(data, data + size, rhs.data);
+    return simd::equal(data, rhs.data, size);
 }
 
 bool DynamicArray::operator!=(const DynamicArray& rhs) const {
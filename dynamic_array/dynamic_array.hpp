@@ -1,24 +1,84 @@
+#ifndef DYNAMIC_ARRAY_HPP
+#define DYNAMIC_ARRAY_HPP
+
 #include <initializer_list>
 #include <cstdint>
 #include <algorithm>
+#include <memory_resource>
 #include <stdexcept>
 
+// Стратегия увеличения ёмкости при нехватке места
+enum class GrowthPolicy {
+    Double,       //!< ёмкость * 2
+    OneAndHalf,   //!< ёмкость * 1.5
+    PageRounded   //!< ёмкость * 2 с округлением вверх до целой страницы памяти
+};
+
+// Выравнивание начала буфера
+enum class Alignment : int64_t {
+    Default = 0,      //!< как у malloc (16 байт)
+    CacheLine = 64,   //!< для выровненных SIMD-загрузок и без ложного разделения
+    Page = 4096
+};
+
 class DynamicArray {
 public:
+    // Буфер, отданный release(): освобождать через deallocate(data, capacity).
+    // От ёмкости зависит способ освобождения (free или munmap)
+    struct Buffer {
+        int* data = nullptr;
+        int64_t capacity = 0;
+    };
+
     DynamicArray(int64_t size = 0, int value = 0);
 
+    // Память выделяется из resource (например, из арены запроса), а не через
+    // malloc; ресурс должен пережить массив
+    DynamicArray(int64_t size, int value, std::pmr::memory_resource* resource);
+
+    // Буфер с выравниванием alignment; huge_pages просит ядро отображать
+    // большие (от 64 МиБ) буферы страницами по 2 МиБ (madvise(MADV_HUGEPAGE))
+    DynamicArray(int64_t size, int value, Alignment alignment, bool huge_pages = false);
+
     DynamicArray(const std::initializer_list<int>& list);
 
+    // Копия, как и у std::pmr-контейнеров, использует память по умолчанию;
+    // выравнивание и huge_pages копируются
     DynamicArray(const DynamicArray& other);
 
+    DynamicArray(const DynamicArray& other, std::pmr::memory_resource* resource);
+
     DynamicArray& operator=(const DynamicArray& rhs);
 
+    // Перемещение передаёт буфер вместе с его ресурсом и параметрами хранения
+    DynamicArray(DynamicArray&& other) noexcept;
+
+    DynamicArray& operator=(DynamicArray&& rhs) noexcept;
+
     ~DynamicArray();
 
     int64_t Size() const;
     int64_t Capacity() const;
     bool empty() const;
 
+    // Ресурс, из которого выделяется буфер; nullptr — malloc/mmap по умолчанию
+    std::pmr::memory_resource* memory_resource() const;
+
+    GrowthPolicy growth_policy() const;
+    void set_growth_policy(GrowthPolicy policy);
+
+    Alignment alignment() const;
+    bool huge_pages() const;
+
+    // Переносит элементы в буфер с новыми параметрами хранения
+    void set_storage(Alignment alignment, bool huge_pages = false);
+
+    // Гарантирует ёмкость не меньше new_capacity без изменения размера
+    void reserve(int64_t new_capacity);
+
+    // Уменьшает ёмкость до текущего размера и возвращает лишнюю память
+    void shrink_to_fit();
+
     void push_back(int value);
 
     void pop_back();
@@ -31,12 +91,50 @@ public:
 
     void assign(int64_t new_size, int value);
 
+    // Как resize, но новые элементы не инициализируются: для буферов, которые
+    // сразу перезапишет read или вычисление, страницы не трогаются дважды
+    void resize_for_overwrite(int64_t new_size);
+
+    // Добавляет count неинициализированных элементов в конец и возвращает
+    // указатель на первый из них; действителен до следующей реаллокации
+    int* append_uninitialized(int64_t count);
+
     void insert(int64_t index, int value);
 
+    // Вставка диапазона [first, last): хвост сдвигается один раз, не больше одной реаллокации
+    void insert(int64_t index, const int* first, const int* last);
+
+    void append(const int* first, const int* last);
+
+    // Удаление элементов с индексами [first_index, last_index)
+    void erase(int64_t first_index, int64_t last_index);
+
+    // Удаляет элементы, для которых pred истинен, за один проход; возвращает их число
+    template <typename Pred>
+    int64_t remove_if(Pred pred);
+
     void swap(DynamicArray& other);
 
+    // Передаёт буфер вместе с его ёмкостью вызывающему, массив становится пустым.
+    // Буфер массива с memory_resource через deallocate не освободить:
+    // std::logic_error, массив не меняется
+    Buffer release();
+
+    // Забирает во владение буфер, выделенный через allocate(new_capacity);
+    // дальше массив использует память и выравнивание по умолчанию. Свой же
+    // буфер (ptr == begin()) только меняет размер; new_capacity должна
+    // совпадать с Capacity(), иначе std::invalid_argument.
+    // Массиву с memory_resource чужой буфер не передать: std::logic_error
+    void adopt(int* ptr, int64_t new_size, int64_t new_capacity);
+
+    // Хранилище: malloc/realloc, а для больших буферов — mmap/mremap (Linux)
+    static int* allocate(int64_t capacity);
+    static void deallocate(int* ptr, int64_t capacity) noexcept;
+
     int* begin();
     int* end();
+    const int* begin() const;
+    const int* end() const;
 
     int& at(int64_t i) const;
 
@@ -47,7 +145,31 @@ public:
     bool operator!=(const DynamicArray& rhs) const;
 
 private:
+    void reallocate(int64_t new_capacity);
+
+    // allocate/deallocate либо memory_resource массива
+    int* acquire(int64_t new_capacity) const;
+    void dispose(int* ptr, int64_t old_capacity) const noexcept;
+    size_t resource_alignment() const;
+
+    // Ёмкость для роста до required элементов согласно policy
+    int64_t next_capacity(int64_t required) const;
+
     int64_t size = 0;
     int64_t capacity = 0;
     int* data = nullptr;
+    GrowthPolicy policy = GrowthPolicy::Double;
+    std::pmr::memory_resource* resource = nullptr;
+    Alignment align = Alignment::Default;
+    bool huge = false;
 };
+
+template <typename Pred>
+int64_t DynamicArray::remove_if(Pred pred) {
+    int* new_end = std::remove_if(data, data + size, pred);
+    int64_t removed = (data + size) - new_end;
+    size -= removed;
+    return removed;
+}
+
+#endif // DYNAMIC_ARRAY_HPP
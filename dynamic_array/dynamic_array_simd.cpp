@@ -0,0 +1,392 @@
+#include "dynamic_array_simd.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define DYNAMIC_ARRAY_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace simd {
+namespace {
+
+struct Kernels {
+    int64_t (*sum)(const int*, int64_t);
+    MinMax (*min_max)(const int*, int64_t);
+    int64_t (*count)(const int*, int64_t, int);
+    int64_t (*find)(const int*, int64_t, int);
+    bool (*equal)(const int*, const int*, int64_t);
+    void (*fill)(int*, int64_t, int);
+};
+
+// Скалярные версии: запасной путь и обработка хвостов векторных циклов
+
+int64_t sum_scalar(const int* data, int64_t n) {
+    int64_t total = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+MinMax min_max_scalar(const int* data, int64_t n) {
+    MinMax result{data[0], data[0]};
+    for (int64_t i = 1; i < n; ++i) {
+        result.min = std::min(result.min, data[i]);
+        result.max = std::max(result.max, data[i]);
+    }
+    return result;
+}
+
+int64_t count_scalar(const int* data, int64_t n, int value) {
+    int64_t total = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        total += data[i] == value;
+    }
+    return total;
+}
+
+int64_t find_scalar(const int* data, int64_t n, int value) {
+    for (int64_t i = 0; i < n; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool equal_scalar(const int* lhs, const int* rhs, int64_t n) {
+    return std::equal(lhs, lhs + n, rhs);
+}
+
+void fill_scalar(int* data, int64_t n, int value) {
+    std::fill(data, data + n, value);
+}
+
+#ifdef DYNAMIC_ARRAY_SIMD_X86
+
+// SSE4.2: 4 элемента за итерацию
+
+__attribute__((target("sse4.2")))
+int64_t sum_sse42(const int* data, int64_t n) {
+    __m128i acc = _mm_setzero_si128();
+    int64_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(v));
+        acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+    }
+    int64_t lanes[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return lanes[0] + lanes[1] + sum_scalar(data + i, n - i);
+}
+
+__attribute__((target("sse4.2")))
+MinMax min_max_sse42(const int* data, int64_t n) {
+    if (n < 4) {
+        return min_max_scalar(data, n);
+    }
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    __m128i hi = lo;
+    int64_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        lo = _mm_min_epi32(lo, v);
+        hi = _mm_max_epi32(hi, v);
+    }
+    int mins[4];
+    int maxs[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(mins), lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(maxs), hi);
+    MinMax result{*std::min_element(mins, mins + 4), *std::max_element(maxs, maxs + 4)};
+    for (; i < n; ++i) {
+        result.min = std::min(result.min, data[i]);
+        result.max = std::max(result.max, data[i]);
+    }
+    return result;
+}
+
+__attribute__((target("sse4.2,popcnt")))
+int64_t count_sse42(const int* data, int64_t n, int value) {
+    __m128i needle = _mm_set1_epi32(value);
+    int64_t total = 0;
+    int64_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, needle)));
+        total += _mm_popcnt_u32(static_cast<unsigned>(mask));
+    }
+    return total + count_scalar(data + i, n - i, value);
+}
+
+__attribute__((target("sse4.2")))
+int64_t find_sse42(const int* data, int64_t n, int value) {
+    __m128i needle = _mm_set1_epi32(value);
+    int64_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+    }
+    int64_t tail = find_scalar(data + i, n - i, value);
+    return tail < 0 ? -1 : i + tail;
+}
+
+__attribute__((target("sse4.2")))
+bool equal_sse42(const int* lhs, const int* rhs, int64_t n) {
+    int64_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+        __m128i diff = _mm_xor_si128(a, b);
+        if (!_mm_testz_si128(diff, diff)) {
+            return false;
+        }
+    }
+    return equal_scalar(lhs + i, rhs + i, n - i);
+}
+
+__attribute__((target("sse4.2")))
+void fill_sse42(int* data, int64_t n, int value) {
+    __m128i v = _mm_set1_epi32(value);
+    int64_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), v);
+    }
+    fill_scalar(data + i, n - i, value);
+}
+
+// AVX2: 8 элементов за итерацию
+
+__attribute__((target("avx2")))
+int64_t sum_avx2(const int* data, int64_t n) {
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    int64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_scalar(data + i, n - i);
+}
+
+__attribute__((target("avx2")))
+MinMax min_max_avx2(const int* data, int64_t n) {
+    if (n < 8) {
+        return min_max_scalar(data, n);
+    }
+    __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    __m256i hi = lo;
+    int64_t i = 8;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        lo = _mm256_min_epi32(lo, v);
+        hi = _mm256_max_epi32(hi, v);
+    }
+    int mins[8];
+    int maxs[8];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(mins), lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(maxs), hi);
+    MinMax result{*std::min_element(mins, mins + 8), *std::max_element(maxs, maxs + 8)};
+    for (; i < n; ++i) {
+        result.min = std::min(result.min, data[i]);
+        result.max = std::max(result.max, data[i]);
+    }
+    return result;
+}
+
+__attribute__((target("avx2,popcnt")))
+int64_t count_avx2(const int* data, int64_t n, int value) {
+    __m256i needle = _mm256_set1_epi32(value);
+    int64_t total = 0;
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, needle)));
+        total += _mm_popcnt_u32(static_cast<unsigned>(mask));
+    }
+    return total + count_scalar(data + i, n - i, value);
+}
+
+__attribute__((target("avx2")))
+int64_t find_avx2(const int* data, int64_t n, int value) {
+    __m256i needle = _mm256_set1_epi32(value);
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+    }
+    int64_t tail = find_scalar(data + i, n - i, value);
+    return tail < 0 ? -1 : i + tail;
+}
+
+__attribute__((target("avx2")))
+bool equal_avx2(const int* lhs, const int* rhs, int64_t n) {
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+        __m256i diff = _mm256_xor_si256(a, b);
+        if (!_mm256_testz_si256(diff, diff)) {
+            return false;
+        }
+    }
+    return equal_scalar(lhs + i, rhs + i, n - i);
+}
+
+__attribute__((target("avx2")))
+void fill_avx2(int* data, int64_t n, int value) {
+    __m256i v = _mm256_set1_epi32(value);
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), v);
+    }
+    fill_scalar(data + i, n - i, value);
+}
+
+#endif // DYNAMIC_ARRAY_SIMD_X86
+
+const Kernels kScalar{sum_scalar, min_max_scalar, count_scalar, find_scalar, equal_scalar, fill_scalar};
+#ifdef DYNAMIC_ARRAY_SIMD_X86
+const Kernels kSSE42{sum_sse42, min_max_sse42, count_sse42, find_sse42, equal_sse42, fill_sse42};
+const Kernels kAVX2{sum_avx2, min_max_avx2, count_avx2, find_avx2, equal_avx2, fill_avx2};
+#endif
+
+const Kernels& kernels_for(Level level) {
+    switch (level) {
+#ifdef DYNAMIC_ARRAY_SIMD_X86
+    case Level::AVX2:
+        return kAVX2;
+    case Level::SSE42:
+        return kSSE42;
+#endif
+    default:
+        return kScalar;
+    }
+}
+
+// Атомарны, потому что set_level может вызываться, пока ядра работают в
+// других потоках (например, в ThreadPool)
+std::atomic<Level>& current_level() {
+    static std::atomic<Level> level{detected_level()};
+    return level;
+}
+
+// Таблица ядер текущего уровня; set_level подменяет её
+std::atomic<const Kernels*>& active_table() {
+    static std::atomic<const Kernels*> table{&kernels_for(current_level().load(std::memory_order_relaxed))};
+    return table;
+}
+
+const Kernels& kernels() {
+    return *active_table().load(std::memory_order_acquire);
+}
+
+} // namespace
+
+Level detected_level() {
+#ifdef DYNAMIC_ARRAY_SIMD_X86
+    static const Level level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+            return Level::AVX2;
+        }
+        if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) {
+            return Level::SSE42;
+        }
+        return Level::Scalar;
+    }();
+    return level;
+#else
+    return Level::Scalar;
+#endif
+}
+
+Level active_level() {
+    return current_level().load(std::memory_order_relaxed);
+}
+
+void set_level(Level level) {
+    Level chosen = std::min(level, detected_level());
+    current_level().store(chosen, std::memory_order_relaxed);
+    active_table().store(&kernels_for(chosen), std::memory_order_release);
+}
+
+int64_t sum(const int* data, int64_t n) {
+    return kernels().sum(data, n);
+}
+
+MinMax min_max(const int* data, int64_t n) {
+    if (n <= 0) {
+        throw std::out_of_range("Cannot take min/max of an empty array");
+    }
+    return kernels().min_max(data, n);
+}
+
+int64_t count(const int* data, int64_t n, int value) {
+    return kernels().count(data, n, value);
+}
+
+int64_t find(const int* data, int64_t n, int value) {
+    return kernels().find(data, n, value);
+}
+
+bool equal(const int* lhs, const int* rhs, int64_t n) {
+    return kernels().equal(lhs, rhs, n);
+}
+
+void fill(int* data, int64_t n, int value) {
+    kernels().fill(data, n, value);
+}
+
+int64_t sum(const DynamicArray& arr) {
+    return sum(arr.begin(), arr.Size());
+}
+
+MinMax min_max(const DynamicArray& arr) {
+    return min_max(arr.begin(), arr.Size());
+}
+
+int64_t count(const DynamicArray& arr, int value) {
+    return count(arr.begin(), arr.Size(), value);
+}
+
+int64_t find(const DynamicArray& arr, int value) {
+    return find(arr.begin(), arr.Size(), value);
+}
+
+int64_t sum(ArrayView view) {
+    return sum(view.data(), view.Size());
+}
+
+MinMax min_max(ArrayView view) {
+    return min_max(view.data(), view.Size());
+}
+
+int64_t count(ArrayView view, int value) {
+    return count(view.data(), view.Size(), value);
+}
+
+int64_t find(ArrayView view, int value) {
+    return find(view.data(), view.Size(), value);
+}
+
+bool equal(ArrayView lhs, ArrayView rhs) {
+    return lhs.Size() == rhs.Size() && equal(lhs.data(), rhs.data(), lhs.Size());
+}
+
+void fill(ArraySpan span, int value) {
+    fill(span.data(), span.Size(), value);
+}
+
+} // namespace simd
@@ -0,0 +1,60 @@
+#ifndef DYNAMIC_ARRAY_SIMD_HPP
+#define DYNAMIC_ARRAY_SIMD_HPP
+
+#include <cstdint>
+#include "dynamic_array.hpp"
+#include "array_view.hpp"
+
+// Векторизованные просмотры содержимого DynamicArray. Реализация (AVX2,
+// SSE4.2 или скалярная) выбирается один раз по возможностям процессора.
+namespace simd {
+
+enum class Level {
+    Scalar,
+    SSE42,
+    AVX2
+};
+
+// Лучший уровень, поддерживаемый процессором
+Level detected_level();
+
+// Текущий уровень; по умолчанию равен detected_level()
+Level active_level();
+
+// Принудительный выбор уровня (например, для тестов); не выше detected_level().
+// Безопасен при параллельных вызовах ядер: они видят старую или новую таблицу
+void set_level(Level level);
+
+struct MinMax {
+    int min;
+    int max;
+};
+
+int64_t sum(const int* data, int64_t n);
+MinMax min_max(const int* data, int64_t n);
+int64_t count(const int* data, int64_t n, int value);
+int64_t find(const int* data, int64_t n, int value);
+bool equal(const int* lhs, const int* rhs, int64_t n);
+void fill(int* data, int64_t n, int value);
+
+int64_t sum(const DynamicArray& arr);
+
+// Бросает std::out_of_range для пустого массива
+MinMax min_max(const DynamicArray& arr);
+
+int64_t count(const DynamicArray& arr, int value);
+
+// Индекс первого вхождения value или -1
+int64_t find(const DynamicArray& arr, int value);
+
+// Те же операции над участками массивов без копирования
+int64_t sum(ArrayView view);
+MinMax min_max(ArrayView view);
+int64_t count(ArrayView view, int value);
+int64_t find(ArrayView view, int value);
+bool equal(ArrayView lhs, ArrayView rhs);
+void fill(ArraySpan span, int value);
+
+} // namespace simd
+
+#endif // DYNAMIC_ARRAY_SIMD_HPP
@@ -0,0 +1,280 @@
+#ifndef GAP_ARRAY_HPP
+#define GAP_ARRAY_HPP
+
+#include <initializer_list>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Массив с подвижным разрывом (gap buffer): свободная ёмкость хранится
+// не в конце, а в месте последней правки. Вставка и удаление у разрыва
+// стоят O(1); при правке в другом месте разрыв переезжает туда, сдвигая
+// только элементы между старой и новой позицией. Подходит для правок
+// вокруг курсора, как в текстовом редакторе.
+template <typename T>
+class GapArray {
+public:
+    template <bool Const>
+    class Iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+        using owner_type = std::conditional_t<Const, const GapArray, GapArray>;
+
+        Iterator() = default;
+        Iterator(owner_type* owner, int64_t index) : owner_(owner), index_(index) {}
+
+        // Обычный итератор приводится к константному
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other) : owner_(other.owner_), index_(other.index_) {}
+
+        reference operator*() const { return (*owner_)[index_]; }
+        pointer operator->() const { return &(*owner_)[index_]; }
+        reference operator[](difference_type n) const { return (*owner_)[index_ + n]; }
+
+        Iterator& operator++() { ++index_; return *this; }
+        Iterator operator++(int) { Iterator tmp = *this; ++index_; return tmp; }
+        Iterator& operator--() { --index_; return *this; }
+        Iterator operator--(int) { Iterator tmp = *this; --index_; return tmp; }
+        Iterator& operator+=(difference_type n) { index_ += n; return *this; }
+        Iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+
+        friend Iterator operator+(Iterator it, difference_type n) { return it += n; }
+        friend Iterator operator+(difference_type n, Iterator it) { return it += n; }
+        friend Iterator operator-(Iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const Iterator& a, const Iterator& b) { return a.index_ - b.index_; }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.index_ == b.index_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.index_ != b.index_; }
+        friend bool operator<(const Iterator& a, const Iterator& b) { return a.index_ < b.index_; }
+        friend bool operator>(const Iterator& a, const Iterator& b) { return a.index_ > b.index_; }
+        friend bool operator<=(const Iterator& a, const Iterator& b) { return a.index_ <= b.index_; }
+        friend bool operator>=(const Iterator& a, const Iterator& b) { return a.index_ >= b.index_; }
+
+    private:
+        friend class Iterator<!Const>;
+
+        owner_type* owner_ = nullptr;
+        int64_t index_ = 0;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    GapArray(int64_t size = 0, const T& value = T()) {
+        if (size < 0) {
+            throw std::invalid_argument("Size cannot be negative");
+        }
+        assign(size, value);
+    }
+
+    GapArray(const std::initializer_list<T>& list) {
+        reserve(static_cast<int64_t>(list.size()));
+        std::copy(list.begin(), list.end(), data_);
+        gap_start_ = static_cast<int64_t>(list.size());
+    }
+
+    GapArray(const GapArray& other)
+        : data_(other.capacity_ > 0 ? new T[other.capacity_] : nullptr),
+          capacity_(other.capacity_), gap_start_(other.gap_start_), gap_end_(other.gap_end_) {
+        std::copy(other.data_, other.data_ + other.gap_start_, data_);
+        std::copy(other.data_ + other.gap_end_, other.data_ + other.capacity_, data_ + gap_end_);
+    }
+
+    GapArray(GapArray&& other) noexcept
+        : data_(other.data_), capacity_(other.capacity_),
+          gap_start_(other.gap_start_), gap_end_(other.gap_end_) {
+        other.data_ = nullptr;
+        other.capacity_ = other.gap_start_ = other.gap_end_ = 0;
+    }
+
+    GapArray& operator=(const GapArray& rhs) {
+        if (this != &rhs) {
+            GapArray tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    GapArray& operator=(GapArray&& rhs) noexcept {
+        if (this != &rhs) {
+            GapArray tmp(std::move(rhs));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    ~GapArray() {
+        delete[] data_;
+    }
+
+    int64_t Size() const { return capacity_ - gap_size(); }
+    int64_t Capacity() const { return capacity_; }
+    bool empty() const { return Size() == 0; }
+
+    // Позиция разрыва: индекс, перед которым вставка ничего не сдвигает
+    int64_t gap_position() const { return gap_start_; }
+
+    // Переносит разрыв к индексу index, сдвигая элементы между позициями
+    void move_gap(int64_t index) {
+        if (index < 0 || index > Size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        if (gap_size() == 0) {
+            // Без разрыва сдвигать нечего, а перемещение элемента в себя его испортило бы
+            gap_start_ = gap_end_ = index;
+            return;
+        }
+        if (index < gap_start_) {
+            std::move_backward(data_ + index, data_ + gap_start_, data_ + gap_end_);
+        } else if (index > gap_start_) {
+            std::move(data_ + gap_end_, data_ + gap_end_ + (index - gap_start_), data_ + gap_start_);
+        }
+        gap_end_ += index - gap_start_;
+        gap_start_ = index;
+    }
+
+    void reserve(int64_t new_capacity) {
+        if (new_capacity < 0) {
+            throw std::invalid_argument("Capacity cannot be negative");
+        }
+        if (new_capacity > capacity_) {
+            reallocate(new_capacity);
+        }
+    }
+
+    void insert(int64_t index, const T& value) {
+        if (index < 0 || index > Size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        T copy = value;  // value может ссылаться на элемент этого массива
+        if (gap_size() == 0) {
+            reallocate(std::max<int64_t>(1, capacity_ * 2));
+        }
+        move_gap(index);
+        data_[gap_start_++] = std::move(copy);
+    }
+
+    void erase(int64_t index) {
+        if (index < 0 || index >= Size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        // Удаление элемента сразу за разрывом или перед ним только сдвигает границу
+        if (index == gap_start_) {
+            ++gap_end_;
+        } else {
+            move_gap(index + 1);
+            --gap_start_;
+        }
+    }
+
+    void push_back(const T& value) { insert(Size(), value); }
+
+    void pop_back() {
+        if (empty()) {
+            throw std::out_of_range("Cannot pop from an empty array");
+        }
+        erase(Size() - 1);
+    }
+
+    void clear() {
+        gap_start_ = 0;
+        gap_end_ = capacity_;
+    }
+
+    void resize(int64_t new_size) {
+        if (new_size < 0) {
+            throw std::invalid_argument("Size cannot be negative");
+        }
+        int64_t size = Size();
+        if (new_size < size) {
+            move_gap(new_size);
+            gap_end_ = capacity_;
+            return;
+        }
+        reserve(new_size);
+        move_gap(size);
+        std::fill(data_ + gap_start_, data_ + gap_start_ + (new_size - size), T());
+        gap_start_ += new_size - size;
+    }
+
+    void assign(int64_t new_size, const T& value) {
+        if (new_size < 0) {
+            throw std::invalid_argument("Size cannot be negative");
+        }
+        T copy = value;
+        clear();
+        reserve(new_size);
+        std::fill(data_, data_ + new_size, copy);
+        gap_start_ = new_size;
+    }
+
+    void swap(GapArray& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(gap_start_, other.gap_start_);
+        std::swap(gap_end_, other.gap_end_);
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, Size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, Size()); }
+
+    T& at(int64_t i) {
+        check_index(i);
+        return (*this)[i];
+    }
+
+    const T& at(int64_t i) const {
+        check_index(i);
+        return (*this)[i];
+    }
+
+    T& operator[](int64_t i) { return data_[physical(i)]; }
+    const T& operator[](int64_t i) const { return data_[physical(i)]; }
+
+    bool operator==(const GapArray& rhs) const {
+        return Size() == rhs.Size() && std::equal(begin(), end(), rhs.begin());
+    }
+
+    bool operator!=(const GapArray& rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    int64_t gap_size() const { return gap_end_ - gap_start_; }
+
+    int64_t physical(int64_t i) const { return i < gap_start_ ? i : i + gap_size(); }
+
+    void check_index(int64_t i) const {
+        if (i < 0 || i >= Size()) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    // Новый буфер сохраняет положение разрыва, весь прирост уходит в разрыв
+    void reallocate(int64_t new_capacity) {
+        T* fresh = new T[new_capacity];
+        int64_t tail = capacity_ - gap_end_;
+        std::move(data_, data_ + gap_start_, fresh);
+        std::move(data_ + gap_end_, data_ + capacity_, fresh + new_capacity - tail);
+        delete[] data_;
+        data_ = fresh;
+        gap_end_ = new_capacity - tail;
+        capacity_ = new_capacity;
+    }
+
+    T* data_ = nullptr;       //!< буфер: [0, gap_start_) и [gap_end_, capacity_) заняты
+    int64_t capacity_ = 0;
+    int64_t gap_start_ = 0;   //!< первый свободный слот
+    int64_t gap_end_ = 0;     //!< первый занятый слот после разрыва
+};
+
+#endif // GAP_ARRAY_HPP
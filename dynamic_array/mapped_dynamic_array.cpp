@@ -0,0 +1,309 @@
+#include "mapped_dynamic_array.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr int64_t kHeaderBytes = 64;
+constexpr char kMagic[8] = {'D', 'A', 'M', 'A', 'P', 'V', '0', '1'};
+// Минимальный шаг роста, чтобы не дёргать ftruncate на каждый push_back
+constexpr int64_t kMinCapacity = 1024;
+
+struct Header {
+    char magic[8];
+    int64_t size;
+};
+
+int64_t mapped_bytes(int64_t capacity) {
+    return kHeaderBytes + capacity * static_cast<int64_t>(sizeof(int));
+}
+
+[[noreturn]] void throw_errno(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+int advice_flag(MappedDynamicArray::Access hint) {
+    switch (hint) {
+    case MappedDynamicArray::Access::Sequential:
+        return MADV_SEQUENTIAL;
+    case MappedDynamicArray::Access::Random:
+        return MADV_RANDOM;
+    case MappedDynamicArray::Access::WillNeed:
+        return MADV_WILLNEED;
+    case MappedDynamicArray::Access::DontNeed:
+        return MADV_DONTNEED;
+    default:
+        return MADV_NORMAL;
+    }
+}
+
+} // namespace
+
+MappedDynamicArray::MappedDynamicArray(const std::string& path, Mode mode)
+    : readonly(mode == Mode::ReadOnly) {
+    int flags = readonly ? O_RDONLY : O_RDWR | O_CREAT;
+    if (mode == Mode::Create) {
+        flags |= O_TRUNC;
+    }
+    fd = ::open(path.c_str(), flags, 0644);
+    if (fd < 0) {
+        throw_errno("open");
+    }
+
+    struct stat st {};
+    if (fstat(fd, &st) != 0) {
+        int err = errno;
+        ::close(fd);
+        throw std::system_error(err, std::generic_category(), "fstat");
+    }
+    int64_t file_bytes = st.st_size;
+
+    if (file_bytes == 0 && !readonly) {
+        Header header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        if (ftruncate(fd, kHeaderBytes) != 0 || pwrite(fd, &header, sizeof(header), 0) != sizeof(header)) {
+            int err = errno;
+            ::close(fd);
+            throw std::system_error(err, std::generic_category(), "initialize header");
+        }
+        file_bytes = kHeaderBytes;
+    }
+
+    Header header{};
+    if (file_bytes < kHeaderBytes || pread(fd, &header, sizeof(header), 0) != sizeof(header) ||
+        std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Not a mapped array file: " + path);
+    }
+    capacity = (file_bytes - kHeaderBytes) / static_cast<int64_t>(sizeof(int));
+    if (header.size < 0 || header.size > capacity) {
+        ::close(fd);
+        throw std::runtime_error("Corrupted mapped array header: " + path);
+    }
+    size = header.size;
+
+    int prot = readonly ? PROT_READ : PROT_READ | PROT_WRITE;
+    void* p = mmap(nullptr, mapped_bytes(capacity), prot, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) {
+        int err = errno;
+        ::close(fd);
+        throw std::system_error(err, std::generic_category(), "mmap");
+    }
+    base = static_cast<char*>(p);
+    data = reinterpret_cast<int*>(base + kHeaderBytes);
+}
+
+MappedDynamicArray::MappedDynamicArray(MappedDynamicArray&& other) noexcept
+    : fd(other.fd), base(other.base), data(other.data),
+      size(other.size), capacity(other.capacity), readonly(other.readonly) {
+    other.fd = -1;
+    other.base = nullptr;
+    other.data = nullptr;
+    other.size = 0;
+    other.capacity = 0;
+}
+
+MappedDynamicArray& MappedDynamicArray::operator=(MappedDynamicArray&& rhs) noexcept {
+    if (this != &rhs) {
+        close();
+        fd = rhs.fd;
+        base = rhs.base;
+        data = rhs.data;
+        size = rhs.size;
+        capacity = rhs.capacity;
+        readonly = rhs.readonly;
+        rhs.fd = -1;
+        rhs.base = nullptr;
+        rhs.data = nullptr;
+        rhs.size = 0;
+        rhs.capacity = 0;
+    }
+    return *this;
+}
+
+MappedDynamicArray::~MappedDynamicArray() {
+    close();
+}
+
+void MappedDynamicArray::close() noexcept {
+    if (fd < 0) {
+        return;
+    }
+    if (!readonly) {
+        store_size();
+    }
+    munmap(base, mapped_bytes(capacity));
+    if (!readonly) {
+        // Запас ёмкости не остаётся в файле; при ошибке файл всё равно
+        // корректен, так как размер уже записан в заголовок
+        int truncated = ftruncate(fd, mapped_bytes(size));
+        (void)truncated;
+    }
+    ::close(fd);
+    fd = -1;
+    base = nullptr;
+    data = nullptr;
+}
+
+int64_t MappedDynamicArray::Size() const { return size; }
+int64_t MappedDynamicArray::Capacity() const { return capacity; }
+bool MappedDynamicArray::empty() const { return size == 0; }
+bool MappedDynamicArray::read_only() const { return readonly; }
+
+void MappedDynamicArray::check_writable() const {
+    if (readonly) {
+        throw std::logic_error("Array is opened read-only");
+    }
+}
+
+void MappedDynamicArray::store_size() {
+    reinterpret_cast<Header*>(base)->size = size;
+}
+
+void MappedDynamicArray::remap(int64_t new_capacity) {
+    int64_t old_bytes = mapped_bytes(capacity);
+    int64_t new_bytes = mapped_bytes(new_capacity);
+    if (ftruncate(fd, new_bytes) != 0) {
+        throw_errno("ftruncate");
+    }
+#if defined(__linux__)
+    void* p = mremap(base, old_bytes, new_bytes, MREMAP_MAYMOVE);
+    if (p == MAP_FAILED) {
+        throw_errno("mremap");
+    }
+#else
+    void* p = mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) {
+        throw_errno("mmap");
+    }
+    munmap(base, old_bytes);
+#endif
+    base = static_cast<char*>(p);
+    data = reinterpret_cast<int*>(base + kHeaderBytes);
+    capacity = new_capacity;
+}
+
+void MappedDynamicArray::reserve(int64_t new_capacity) {
+    check_writable();
+    if (new_capacity < 0) {
+        throw std::invalid_argument("Capacity cannot be negative");
+    }
+    if (new_capacity > capacity) {
+        remap(new_capacity);
+    }
+}
+
+void MappedDynamicArray::push_back(int value) {
+    check_writable();
+    if (size == capacity) {
+        remap(std::max(kMinCapacity, capacity * 2));
+    }
+    data[size++] = value;
+}
+
+void MappedDynamicArray::pop_back() {
+    check_writable();
+    if (size > 0) {
+        --size;
+    } else {
+        throw std::out_of_range("Cannot pop from an empty array");
+    }
+}
+
+void MappedDynamicArray::clear() {
+    check_writable();
+    size = 0;
+}
+
+void MappedDynamicArray::resize(int64_t new_size) {
+    check_writable();
+    if (new_size < 0) {
+        throw std::invalid_argument("Size cannot be negative");
+    }
+    int64_t old_capacity = capacity;
+    if (new_size > capacity) {
+        remap(std::max(new_size, capacity * 2));
+    }
+    // Добавленный ftruncate'ом хвост файла уже заполнен нулями
+    if (new_size > size) {
+        std::fill(data + size, data + std::min(new_size, old_capacity), 0);
+    }
+    size = new_size;
+}
+
+// Неконстантный доступ в режиме ReadOnly дал бы запись в страницы PROT_READ
+// и SIGSEGV вместо исключения; читать такой массив нужно через const
+int* MappedDynamicArray::begin() {
+    check_writable();
+    return data;
+}
+
+int* MappedDynamicArray::end() {
+    check_writable();
+    return data + size;
+}
+
+const int* MappedDynamicArray::begin() const { return data; }
+const int* MappedDynamicArray::end() const { return data + size; }
+
+int& MappedDynamicArray::at(int64_t i) {
+    check_writable();
+    if (i < 0 || i >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return data[i];
+}
+
+const int& MappedDynamicArray::at(int64_t i) const {
+    if (i < 0 || i >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return data[i];
+}
+
+int& MappedDynamicArray::operator[](int64_t i) {
+    check_writable();
+    return data[i];
+}
+
+const int& MappedDynamicArray::operator[](int64_t i) const { return data[i]; }
+
+void MappedDynamicArray::flush() {
+    if (readonly) {
+        return;
+    }
+    store_size();
+    if (msync(base, mapped_bytes(capacity), MS_SYNC) != 0) {
+        throw_errno("msync");
+    }
+}
+
+void MappedDynamicArray::advise(Access hint) {
+    advise(hint, 0, size);
+}
+
+void MappedDynamicArray::advise(Access hint, int64_t first, int64_t count) {
+    if (first < 0 || count < 0 || first + count > size) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (count == 0) {
+        return;
+    }
+    // madvise требует адрес, выровненный по странице
+    int64_t page = sysconf(_SC_PAGESIZE);
+    int64_t begin_byte = kHeaderBytes + first * static_cast<int64_t>(sizeof(int));
+    int64_t end_byte = begin_byte + count * static_cast<int64_t>(sizeof(int));
+    begin_byte = begin_byte / page * page;
+    if (madvise(base + begin_byte, end_byte - begin_byte, advice_flag(hint)) != 0) {
+        throw_errno("madvise");
+    }
+}
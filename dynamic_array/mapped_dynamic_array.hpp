@@ -0,0 +1,81 @@
+#ifndef MAPPED_DYNAMIC_ARRAY_HPP
+#define MAPPED_DYNAMIC_ARRAY_HPP
+
+#include <cstdint>
+#include <string>
+
+// Массив int, хранилищем которого служит отображённый в память файл.
+// Файл: 64-байтный заголовок (сигнатура и число элементов) и данные.
+// Открытие существующего файла ничего не копирует, страницы подгружаются
+// ОС по мере обращения; рост расширяет файл через ftruncate и mremap.
+class MappedDynamicArray {
+public:
+    enum class Mode {
+        OpenOrCreate,   //!< открыть существующий файл или создать пустой
+        Create,         //!< создать новый файл, отбросив старое содержимое
+        ReadOnly        //!< только чтение через const; изменяющие методы и неконстантный доступ бросают std::logic_error
+    };
+
+    // Подсказки для madvise
+    enum class Access {
+        Normal,
+        Sequential,
+        Random,
+        WillNeed,
+        DontNeed
+    };
+
+    explicit MappedDynamicArray(const std::string& path, Mode mode = Mode::OpenOrCreate);
+
+    MappedDynamicArray(const MappedDynamicArray&) = delete;
+    MappedDynamicArray& operator=(const MappedDynamicArray&) = delete;
+
+    MappedDynamicArray(MappedDynamicArray&& other) noexcept;
+    MappedDynamicArray& operator=(MappedDynamicArray&& rhs) noexcept;
+
+    // Сохраняет размер в заголовок и обрезает файл до занятых элементов
+    ~MappedDynamicArray();
+
+    int64_t Size() const;
+    int64_t Capacity() const;
+    bool empty() const;
+    bool read_only() const;
+
+    void push_back(int value);
+    void pop_back();
+    void clear();
+    void resize(int64_t new_size);
+    void reserve(int64_t new_capacity);
+
+    int* begin();
+    int* end();
+    const int* begin() const;
+    const int* end() const;
+
+    int& at(int64_t i);
+    const int& at(int64_t i) const;
+
+    int& operator[](int64_t i);
+    const int& operator[](int64_t i) const;
+
+    // Синхронно записывает изменения на диск (msync)
+    void flush();
+
+    void advise(Access hint);
+    void advise(Access hint, int64_t first, int64_t count);
+
+private:
+    void close() noexcept;
+    void check_writable() const;
+    void remap(int64_t new_capacity);
+    void store_size();
+
+    int fd = -1;
+    char* base = nullptr;     //!< начало отображения (заголовок)
+    int* data = nullptr;      //!< первый элемент
+    int64_t size = 0;
+    int64_t capacity = 0;
+    bool readonly = false;
+};
+
+#endif // MAPPED_DYNAMIC_ARRAY_HPP
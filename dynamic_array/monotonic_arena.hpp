@@ -0,0 +1,153 @@
+#ifndef MONOTONIC_ARENA_HPP
+#define MONOTONIC_ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+
+// Арена на время одного запроса: память выдаётся сдвигом указателя внутри
+// блоков, взятых у upstream, а deallocate ничего не делает. reset() разом
+// освобождает всё, что выделили контейнеры запроса; самый большой блок
+// остаётся для следующего запроса, поэтому в установившемся режиме арена
+// не обращается к upstream вовсе.
+// В отличие от std::pmr::monotonic_buffer_resource::release, reset не
+// отдаёт upstream самый большой блок, а рост блоков ограничен сверху.
+class MonotonicArena : public std::pmr::memory_resource {
+public:
+    static constexpr size_t kDefaultBlockBytes = 64 * 1024;
+    static constexpr size_t kMaxBlockBytes = 64 * 1024 * 1024;
+
+    explicit MonotonicArena(size_t initial_block_bytes = kDefaultBlockBytes,
+                            std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : upstream_(upstream), next_block_bytes_(std::max(initial_block_bytes, kMinBlockBytes)) {
+        if (upstream == nullptr) {
+            throw std::invalid_argument("Upstream resource cannot be null");
+        }
+    }
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    ~MonotonicArena() override {
+        release_blocks(nullptr);
+    }
+
+    // Освобождает все выделения; контейнеры, выделявшие из арены, к этому
+    // моменту должны быть уничтожены
+    void reset() {
+        Block* largest = head_;
+        for (Block* b = head_; b != nullptr; b = b->prev) {
+            if (b->bytes > largest->bytes) {
+                largest = b;
+            }
+        }
+        release_blocks(largest);
+        head_ = largest;
+        if (largest != nullptr) {
+            largest->prev = nullptr;
+            cursor_ = largest->begin();
+            end_ = largest->end();
+        } else {
+            cursor_ = end_ = nullptr;
+        }
+        bytes_used_ = 0;
+    }
+
+    // Байт выдано с последнего reset (без учёта выравнивания)
+    size_t bytes_used() const { return bytes_used_; }
+
+    // Байт взято у upstream и ещё не возвращено
+    size_t bytes_reserved() const {
+        size_t total = 0;
+        for (Block* b = head_; b != nullptr; b = b->prev) {
+            total += b->bytes;
+        }
+        return total;
+    }
+
+    int64_t block_count() const {
+        int64_t count = 0;
+        for (Block* b = head_; b != nullptr; b = b->prev) {
+            ++count;
+        }
+        return count;
+    }
+
+    std::pmr::memory_resource* upstream() const { return upstream_; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        char* p = align_up(cursor_, alignment);
+        if (p == nullptr || p > end_ || bytes > static_cast<size_t>(end_ - p)) {
+            grow(bytes, alignment);
+            p = align_up(cursor_, alignment);
+        }
+        cursor_ = p + bytes;
+        bytes_used_ += bytes;
+        return p;
+    }
+
+    // Память возвращается только через reset()
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    static constexpr size_t kMinBlockBytes = 1024;
+
+    // Заголовок блока лежит в начале самого блока
+    struct Block {
+        Block* prev;
+        size_t bytes;   //!< размер вместе с заголовком
+
+        char* begin() { return reinterpret_cast<char*>(this) + sizeof(Block); }
+        char* end() { return reinterpret_cast<char*>(this) + bytes; }
+    };
+
+    static char* align_up(char* p, size_t alignment) {
+        if (p == nullptr) {
+            return nullptr;
+        }
+        auto address = reinterpret_cast<uintptr_t>(p);
+        return p + ((alignment - address % alignment) % alignment);
+    }
+
+    // Следующий блок вдвое больше предыдущего, но не меньше запроса
+    void grow(size_t bytes, size_t alignment) {
+        size_t needed = sizeof(Block) + bytes + alignment;
+        size_t block_bytes = std::max(next_block_bytes_, needed);
+        auto* block = static_cast<Block*>(upstream_->allocate(block_bytes, alignof(std::max_align_t)));
+        block->prev = head_;
+        block->bytes = block_bytes;
+        head_ = block;
+        cursor_ = block->begin();
+        end_ = block->end();
+        next_block_bytes_ = std::min(std::max(next_block_bytes_, block_bytes) * 2, kMaxBlockBytes);
+    }
+
+    // Возвращает upstream все блоки, кроме keep
+    void release_blocks(Block* keep) {
+        Block* b = head_;
+        while (b != nullptr) {
+            Block* prev = b->prev;
+            if (b != keep) {
+                upstream_->deallocate(b, b->bytes, alignof(std::max_align_t));
+            }
+            b = prev;
+        }
+        head_ = nullptr;
+    }
+
+    std::pmr::memory_resource* upstream_;
+    Block* head_ = nullptr;      //!< текущий блок, от него цепочка к более старым
+    char* cursor_ = nullptr;     //!< начало свободной части текущего блока
+    char* end_ = nullptr;
+    size_t next_block_bytes_;
+    size_t bytes_used_ = 0;
+};
+
+#endif // MONOTONIC_ARENA_HPP
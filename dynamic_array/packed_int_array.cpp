@@ -0,0 +1,342 @@
+#include "packed_int_array.hpp"
+#include "dynamic_array_simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define PACKED_INT_ARRAY_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Значение i блока лежит в дорожке i % 4 на позиции i / 4; слово w дорожки
+// l хранится по индексу w * 4 + l. Четыре соседних значения распаковываются
+// из четырёх соседних слов одинаковыми сдвигами.
+constexpr int kLanes = 4;
+constexpr int kPerLane = PackedIntArray::kBlockSize / kLanes;
+
+uint32_t low_mask(int bits) {
+    return bits == 32 ? ~0u : (1u << bits) - 1;
+}
+
+int bit_width(uint64_t v) {
+    int bits = 0;
+    while (v != 0) {
+        ++bits;
+        v >>= 1;
+    }
+    return bits;
+}
+
+void pack(const uint32_t* values, int bits, uint32_t* words) {
+    std::fill(words, words + kLanes * bits, 0u);
+    if (bits == 0) {
+        return;
+    }
+    for (int i = 0; i < PackedIntArray::kBlockSize; ++i) {
+        int lane = i % kLanes;
+        int bit = (i / kLanes) * bits;
+        int w = bit >> 5;
+        int shift = bit & 31;
+        words[w * kLanes + lane] |= values[i] << shift;
+        if (shift + bits > 32) {
+            words[(w + 1) * kLanes + lane] |= values[i] >> (32 - shift);
+        }
+    }
+}
+
+uint32_t unpack_one(const uint32_t* words, int bits, int64_t i) {
+    if (bits == 0) {
+        return 0;
+    }
+    int lane = static_cast<int>(i % kLanes);
+    int bit = static_cast<int>(i / kLanes) * bits;
+    int w = bit >> 5;
+    int shift = bit & 31;
+    uint64_t v = words[w * kLanes + lane] >> shift;
+    if (shift + bits > 32) {
+        v |= static_cast<uint64_t>(words[(w + 1) * kLanes + lane]) << (32 - shift);
+    }
+    return static_cast<uint32_t>(v) & low_mask(bits);
+}
+
+// Распаковка блока: out[i] = base + значение i (по модулю 2^32)
+void unpack_scalar(const uint32_t* words, int bits, uint32_t base, uint32_t* out) {
+    for (int i = 0; i < PackedIntArray::kBlockSize; ++i) {
+        out[i] = base + unpack_one(words, bits, i);
+    }
+}
+
+void prefix_sum_scalar(uint32_t base, uint32_t* out) {
+    uint32_t acc = base;
+    for (int i = 0; i < PackedIntArray::kBlockSize; ++i) {
+        acc += out[i];
+        out[i] = acc;
+    }
+}
+
+#ifdef PACKED_INT_ARRAY_X86
+
+// Ширина — параметр шаблона: сдвиги и ветви становятся константами,
+// а цикл по позициям полностью разворачивается
+template <int Bits>
+__attribute__((target("sse4.2")))
+void unpack_sse42(const uint32_t* words, uint32_t base, uint32_t* out) {
+    const __m128i* in = reinterpret_cast<const __m128i*>(words);
+    const __m128i mask = _mm_set1_epi32(static_cast<int>(low_mask(Bits)));
+    const __m128i offset = _mm_set1_epi32(static_cast<int>(base));
+#pragma GCC unroll 32
+    for (int pos = 0; pos < kPerLane; ++pos) {
+        __m128i v = offset;
+        if (Bits != 0) {
+            const int bit = pos * Bits;
+            const int w = bit >> 5;
+            const int shift = bit & 31;
+            __m128i packed = _mm_srli_epi32(_mm_loadu_si128(in + w), shift);
+            if (shift + Bits > 32) {
+                __m128i next = _mm_loadu_si128(in + w + 1);
+                packed = _mm_or_si128(packed, _mm_slli_epi32(next, 32 - shift));
+            }
+            v = _mm_add_epi32(v, _mm_and_si128(packed, mask));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos * kLanes), v);
+    }
+}
+
+using UnpackKernel = void (*)(const uint32_t*, uint32_t, uint32_t*);
+
+template <int... Bits>
+constexpr std::array<UnpackKernel, sizeof...(Bits)> make_unpack_table(std::integer_sequence<int, Bits...>) {
+    return {&unpack_sse42<Bits>...};
+}
+
+// Ядро распаковки для каждой ширины 0..32
+const std::array<UnpackKernel, 33> kUnpackSse42 = make_unpack_table(std::make_integer_sequence<int, 33>());
+
+// Префиксная сумма по 4 значения: два сдвига со сложением и перенос
+__attribute__((target("sse4.2")))
+void prefix_sum_sse42(uint32_t base, uint32_t* out) {
+    __m128i carry = _mm_set1_epi32(static_cast<int>(base));
+    for (int i = 0; i < PackedIntArray::kBlockSize; i += kLanes) {
+        __m128i* p = reinterpret_cast<__m128i*>(out + i);
+        __m128i v = _mm_loadu_si128(p);
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+        v = _mm_add_epi32(v, carry);
+        _mm_storeu_si128(p, v);
+        carry = _mm_shuffle_epi32(v, 0xFF);
+    }
+}
+
+#endif
+
+} // namespace
+
+PackedIntArray::PackedIntArray(const int* data, int64_t n) {
+    if (n < 0) {
+        throw std::invalid_argument("Size cannot be negative");
+    }
+    int64_t full = n / kBlockSize * kBlockSize;
+    blocks_.reserve(static_cast<size_t>(n / kBlockSize));
+    for (int64_t i = 0; i < full; i += kBlockSize) {
+        encode_block(data + i);
+    }
+    tail_size_ = n - full;
+    std::copy(data + full, data + n, tail_);
+}
+
+PackedIntArray::PackedIntArray(const DynamicArray& arr)
+    : PackedIntArray(arr.begin(), arr.Size()) {}
+
+PackedIntArray::PackedIntArray(const std::initializer_list<int>& list)
+    : PackedIntArray(list.begin(), static_cast<int64_t>(list.size())) {}
+
+int64_t PackedIntArray::Size() const {
+    return static_cast<int64_t>(blocks_.size()) * kBlockSize + tail_size_;
+}
+
+bool PackedIntArray::empty() const {
+    return Size() == 0;
+}
+
+void PackedIntArray::push_back(int value) {
+    tail_[tail_size_++] = value;
+    if (tail_size_ == kBlockSize) {
+        encode_block(tail_);
+        tail_size_ = 0;
+    }
+}
+
+void PackedIntArray::clear() {
+    blocks_.clear();
+    words_.clear();
+    tail_size_ = 0;
+}
+
+void PackedIntArray::encode_block(const int* values) {
+    // Вычисления в int64, чтобы разность крайних int не переполнялась
+    int64_t min = values[0];
+    int64_t max = values[0];
+    int64_t min_delta = 0;
+    int64_t max_delta = 0;
+    for (int64_t i = 1; i < kBlockSize; ++i) {
+        min = std::min<int64_t>(min, values[i]);
+        max = std::max<int64_t>(max, values[i]);
+        int64_t delta = static_cast<int64_t>(values[i]) - values[i - 1];
+        min_delta = std::min(min_delta, delta);
+        max_delta = std::max(max_delta, delta);
+    }
+    int for_bits = bit_width(static_cast<uint64_t>(max - min));
+    int delta_bits = bit_width(static_cast<uint64_t>(max_delta - min_delta));
+
+    BlockHeader header{};
+    header.offset = static_cast<int64_t>(words_.size());
+    header.delta = delta_bits < for_bits;
+
+    uint32_t packed[kBlockSize];
+    if (header.delta) {
+        // Разность первого значения с самим собой равна 0 и тоже сдвигается на ref
+        header.base = values[0];
+        header.delta_ref = static_cast<int32_t>(min_delta);
+        header.bits = static_cast<uint8_t>(delta_bits);
+        packed[0] = static_cast<uint32_t>(-min_delta);
+        for (int64_t i = 1; i < kBlockSize; ++i) {
+            packed[i] = static_cast<uint32_t>(static_cast<int64_t>(values[i]) - values[i - 1] - min_delta);
+        }
+    } else {
+        header.base = static_cast<int32_t>(min);
+        header.delta_ref = 0;
+        header.bits = static_cast<uint8_t>(for_bits);
+        for (int64_t i = 0; i < kBlockSize; ++i) {
+            packed[i] = static_cast<uint32_t>(values[i] - min);
+        }
+    }
+
+    words_.resize(words_.size() + static_cast<size_t>(kLanes * header.bits));
+    pack(packed, header.bits, words_.data() + header.offset);
+    blocks_.push_back(header);
+}
+
+int64_t PackedIntArray::block_count() const {
+    return static_cast<int64_t>(blocks_.size()) + (tail_size_ > 0 ? 1 : 0);
+}
+
+int64_t PackedIntArray::decode_block(int64_t b, int* out) const {
+    if (b < 0 || b >= block_count()) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (b == static_cast<int64_t>(blocks_.size())) {
+        std::copy(tail_, tail_ + tail_size_, out);
+        return tail_size_;
+    }
+    const BlockHeader& header = blocks_[b];
+    const uint32_t* words = words_.data() + header.offset;
+    uint32_t* values = reinterpret_cast<uint32_t*>(out);
+
+    // Для delta-блока сначала восстанавливаются разности, затем префиксная сумма
+    uint32_t base = static_cast<uint32_t>(header.delta ? header.delta_ref : header.base);
+#ifdef PACKED_INT_ARRAY_X86
+    if (simd::active_level() != simd::Level::Scalar) {
+        kUnpackSse42[header.bits](words, base, values);
+        if (header.delta) {
+            prefix_sum_sse42(static_cast<uint32_t>(header.base), values);
+        }
+        return kBlockSize;
+    }
+#endif
+    unpack_scalar(words, header.bits, base, values);
+    if (header.delta) {
+        prefix_sum_scalar(static_cast<uint32_t>(header.base), values);
+    }
+    return kBlockSize;
+}
+
+PackedIntArray::Encoding PackedIntArray::block_encoding(int64_t b) const {
+    if (b < 0 || b >= block_count()) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (b == static_cast<int64_t>(blocks_.size()) || !blocks_[b].delta) {
+        return Encoding::FrameOfReference;
+    }
+    return Encoding::Delta;
+}
+
+int PackedIntArray::block_bits(int64_t b) const {
+    if (b < 0 || b >= block_count()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return b == static_cast<int64_t>(blocks_.size()) ? 32 : blocks_[b].bits;
+}
+
+int PackedIntArray::at(int64_t i) const {
+    if (i < 0 || i >= Size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return (*this)[i];
+}
+
+int PackedIntArray::operator[](int64_t i) const {
+    int64_t b = i / kBlockSize;
+    int64_t k = i % kBlockSize;
+    if (b == static_cast<int64_t>(blocks_.size())) {
+        return tail_[k];
+    }
+    const BlockHeader& header = blocks_[b];
+    const uint32_t* words = words_.data() + header.offset;
+    if (!header.delta) {
+        return static_cast<int>(static_cast<uint32_t>(header.base) + unpack_one(words, header.bits, k));
+    }
+    uint32_t value = static_cast<uint32_t>(header.base);
+    uint32_t ref = static_cast<uint32_t>(header.delta_ref);
+    for (int64_t j = 1; j <= k; ++j) {
+        value += ref + unpack_one(words, header.bits, j);
+    }
+    return static_cast<int>(value);
+}
+
+int64_t PackedIntArray::sum() const {
+    int64_t total = 0;
+    for_each_block([&](const int* values, int64_t count) {
+        total += simd::sum(values, count);
+    });
+    return total;
+}
+
+DynamicArray PackedIntArray::to_array() const {
+    // Буфер не обнуляется заранее: каждый элемент пишет decode_block
+    DynamicArray result;
+    result.resize_for_overwrite(Size());
+    for (int64_t b = 0; b < block_count(); ++b) {
+        decode_block(b, result.begin() + b * kBlockSize);
+    }
+    return result;
+}
+
+int64_t PackedIntArray::memory_bytes() const {
+    return static_cast<int64_t>(blocks_.size() * sizeof(BlockHeader) + words_.size() * sizeof(uint32_t)) +
+           tail_size_ * static_cast<int64_t>(sizeof(int));
+}
+
+bool PackedIntArray::operator==(const PackedIntArray& rhs) const {
+    if (Size() != rhs.Size()) {
+        return false;
+    }
+    int lhs_values[kBlockSize];
+    int rhs_values[kBlockSize];
+    for (int64_t b = 0; b < block_count(); ++b) {
+        int64_t count = decode_block(b, lhs_values);
+        rhs.decode_block(b, rhs_values);
+        if (!simd::equal(lhs_values, rhs_values, count)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PackedIntArray::operator!=(const PackedIntArray& rhs) const {
+    return !(*this == rhs);
+}
@@ -0,0 +1,87 @@
+#ifndef PACKED_INT_ARRAY_HPP
+#define PACKED_INT_ARRAY_HPP
+
+#include <initializer_list>
+#include <cstdint>
+#include <vector>
+#include "dynamic_array.hpp"
+
+// Сжатый массив int. Элементы хранятся блоками по 128 значений, каждый блок
+// упакован в минимальное число бит либо относительно своего минимума
+// (frame of reference), либо как разности соседних значений (delta) — что
+// короче. Значения блока раскладываются по четырём 32-битным дорожкам, так
+// что распаковка идёт сразу по 4 значения векторными сдвигами. Заголовок
+// блока хранит смещение и параметры, поэтому произвольный доступ не требует
+// распаковки соседних блоков. Последний неполный блок хранится как есть.
+class PackedIntArray {
+public:
+    static constexpr int64_t kBlockSize = 128;
+
+    enum class Encoding {
+        FrameOfReference,   //!< значение = base + упакованное смещение
+        Delta               //!< значение = предыдущее + ref + упакованная разность
+    };
+
+    PackedIntArray() = default;
+    PackedIntArray(const int* data, int64_t n);
+    explicit PackedIntArray(const DynamicArray& arr);
+    PackedIntArray(const std::initializer_list<int>& list);
+
+    int64_t Size() const;
+    bool empty() const;
+
+    void push_back(int value);
+    void clear();
+
+    // Значения возвращаются по значению: в памяти они хранятся упакованными.
+    // Для delta-блока доступ стоит до 128 сложений.
+    int at(int64_t i) const;
+    int operator[](int64_t i) const;
+
+    // Блоки, включая неполный последний
+    int64_t block_count() const;
+
+    // Распаковывает блок b в out (не менее kBlockSize элементов), возвращает число значений
+    int64_t decode_block(int64_t b, int* out) const;
+
+    // Параметры упакованного блока; для неполного последнего блока bits = 32
+    Encoding block_encoding(int64_t b) const;
+    int block_bits(int64_t b) const;
+
+    // Последовательный просмотр: fn(const int* values, int64_t count) для каждого блока
+    template <typename F>
+    void for_each_block(F fn) const {
+        int buffer[kBlockSize];
+        for (int64_t b = 0; b < block_count(); ++b) {
+            int64_t count = decode_block(b, buffer);
+            fn(static_cast<const int*>(buffer), count);
+        }
+    }
+
+    int64_t sum() const;
+    DynamicArray to_array() const;
+
+    // Занимаемая элементами и заголовками память в байтах
+    int64_t memory_bytes() const;
+
+    bool operator==(const PackedIntArray& rhs) const;
+    bool operator!=(const PackedIntArray& rhs) const;
+
+private:
+    struct BlockHeader {
+        int64_t offset;      //!< первое слово блока в words_
+        int32_t base;        //!< минимум (FOR) или первое значение (delta)
+        int32_t delta_ref;   //!< минимальная разность для delta-блока
+        uint8_t bits;        //!< ширина упакованного значения, 0..32
+        uint8_t delta;       //!< 1 для delta-блока
+    };
+
+    void encode_block(const int* values);
+
+    std::vector<BlockHeader> blocks_;  //!< заголовки полных блоков
+    std::vector<uint32_t> words_;      //!< упакованные данные, 4 * bits слов на блок
+    int tail_[kBlockSize] = {};        //!< неполный последний блок без сжатия
+    int64_t tail_size_ = 0;
+};
+
+#endif // PACKED_INT_ARRAY_HPP
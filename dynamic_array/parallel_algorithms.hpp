@@ -0,0 +1,291 @@
+#ifndef PARALLEL_ALGORITHMS_HPP
+#define PARALLEL_ALGORITHMS_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "array_view.hpp"
+#include "dynamic_array.hpp"
+#include "thread_pool.hpp"
+
+// Параллельные алгоритмы, работающие прямо с хранилищем DynamicArray
+namespace parallel {
+
+// Минимальный объём работы на одну задачу пула
+constexpr int64_t kGrain = int64_t(1) << 14;
+
+namespace detail {
+
+inline int64_t block_count(int64_t n, const ThreadPool& pool) {
+    return std::max(int64_t(1), std::min((n + kGrain - 1) / kGrain, int64_t(pool.size()) * 4));
+}
+
+// Неинициализированный буфер из n элементов T; объекты в нём создаёт и
+// разрушает вызывающий, буфер только возвращает память
+template <typename T>
+class RawBuffer {
+public:
+    explicit RawBuffer(int64_t n) : n_(n), data_(std::allocator<T>().allocate(n)) {}
+    RawBuffer(const RawBuffer&) = delete;
+    RawBuffer& operator=(const RawBuffer&) = delete;
+    ~RawBuffer() { std::allocator<T>().deallocate(data_, n_); }
+
+    T* get() const { return data_; }
+
+private:
+    int64_t n_;
+    T* data_;
+};
+
+} // namespace detail
+
+template <typename T, typename F>
+void for_each(T* data, int64_t n, F f, ThreadPool& pool = ThreadPool::global()) {
+    pool.parallel_for(n, kGrain, [&](int64_t first, int64_t last) {
+        for (int64_t i = first; i < last; ++i) {
+            f(data[i]);
+        }
+    });
+}
+
+template <typename In, typename Out, typename F>
+void transform(const In* in, int64_t n, Out* out, F f, ThreadPool& pool = ThreadPool::global()) {
+    pool.parallel_for(n, kGrain, [&](int64_t first, int64_t last) {
+        for (int64_t i = first; i < last; ++i) {
+            out[i] = f(in[i]);
+        }
+    });
+}
+
+// Включающий префиксный проход; op должна быть ассоциативной, in может совпадать с out
+template <typename T, typename Op>
+void inclusive_scan(const T* in, int64_t n, T* out, Op op, ThreadPool& pool = ThreadPool::global()) {
+    if (n <= 0) {
+        return;
+    }
+    int64_t blocks = detail::block_count(n, pool);
+    std::vector<T> totals(blocks);
+    auto bounds = [&](int64_t b) { return std::make_pair(n * b / blocks, n * (b + 1) / blocks); };
+
+    // Локальные проходы по блокам
+    pool.parallel_for(blocks, 1, [&](int64_t first, int64_t last) {
+        for (int64_t b = first; b < last; ++b) {
+            auto [begin, end] = bounds(b);
+            T acc = in[begin];
+            out[begin] = acc;
+            for (int64_t i = begin + 1; i < end; ++i) {
+                acc = op(acc, in[i]);
+                out[i] = acc;
+            }
+            totals[b] = acc;
+        }
+    });
+    for (int64_t b = 1; b < blocks; ++b) {
+        totals[b] = op(totals[b - 1], totals[b]);
+    }
+    // Добавляем к каждому блоку сумму предыдущих
+    pool.parallel_for(blocks - 1, 1, [&](int64_t first, int64_t last) {
+        for (int64_t b = first + 1; b < last + 1; ++b) {
+            auto [begin, end] = bounds(b);
+            for (int64_t i = begin; i < end; ++i) {
+                out[i] = op(totals[b - 1], out[i]);
+            }
+        }
+    });
+}
+
+// Устойчивая параллельная сортировка слиянием. T должен перемещаться;
+// конструктор по умолчанию не нужен: буфер слияния не инициализируется,
+// а заполняется перемещением отсортированных блоков
+template <typename T, typename Compare = std::less<T>>
+void merge_sort(T* first, T* last, Compare comp = Compare(), ThreadPool& pool = ThreadPool::global()) {
+    int64_t n = last - first;
+    int64_t blocks = detail::block_count(n, pool);
+    if (blocks <= 1) {
+        std::stable_sort(first, last, comp);
+        return;
+    }
+    auto bound = [&](int64_t b) { return std::min(n, n * b / blocks); };
+
+    // Каждый блок сортируется и сразу переносится в буфер, пока он в кэше
+    detail::RawBuffer<T> buffer(n);
+    pool.parallel_for(blocks, 1, [&](int64_t lo, int64_t hi) {
+        for (int64_t b = lo; b < hi; ++b) {
+            std::stable_sort(first + bound(b), first + bound(b + 1), comp);
+            std::uninitialized_move(first + bound(b), first + bound(b + 1), buffer.get() + bound(b));
+        }
+    });
+
+    // Уровень слияния — одна задача пула на кусок каждой пары, поэтому потоки
+    // заняты и на нижних уровнях, где пар мало, а не только внутри одной пары.
+    // Границы кусков ищутся до слияния: оно перемещает элементы, и двоичный
+    // поиск соседнего куска увидел бы уже перемещённые
+    T* src = buffer.get();
+    T* dst = first;
+    int64_t tasks = int64_t(pool.size()) * 4;
+    std::vector<int64_t> splits;
+    for (int64_t width = 1; width < blocks; width *= 2) {
+        int64_t pairs = (blocks + 2 * width - 1) / (2 * width);
+        int64_t pieces = (tasks + pairs - 1) / pairs;
+        struct Piece {
+            int64_t begin, mid, end;   //!< пара: [begin, mid) и [mid, end)
+            int64_t index, used;       //!< номер куска и число кусков пары
+        };
+        auto piece = [&](int64_t t) {
+            int64_t p = t / pieces;
+            int64_t begin = bound(2 * width * p);
+            int64_t mid = bound(std::min(blocks, 2 * width * p + width));
+            int64_t end = bound(std::min(blocks, 2 * width * (p + 1)));
+            // Куски короче kGrain не дробятся: лишние задачи пары пустые
+            int64_t used = std::max(int64_t(1), std::min(pieces, (mid - begin) / kGrain));
+            return Piece{begin, mid, end, t % pieces, used};
+        };
+        // splits[t] — начало куска t во второй половине пары
+        splits.assign(pairs * pieces + 1, 0);
+        pool.parallel_for(pairs * pieces, 1, [&](int64_t lo, int64_t hi) {
+            for (int64_t t = lo; t < hi; ++t) {
+                Piece pc = piece(t);
+                if (pc.index == 0 || pc.index >= pc.used) {
+                    splits[t] = pc.mid;
+                } else {
+                    T* a = src + pc.begin + (pc.mid - pc.begin) * pc.index / pc.used;
+                    splits[t] = std::lower_bound(src + pc.mid, src + pc.end, *a, comp) - src;
+                }
+            }
+        });
+        pool.parallel_for(pairs * pieces, 1, [&](int64_t lo, int64_t hi) {
+            for (int64_t t = lo; t < hi; ++t) {
+                Piece pc = piece(t);
+                if (pc.index >= pc.used) {
+                    continue;
+                }
+                int64_t na = pc.mid - pc.begin;
+                int64_t ia = pc.begin + na * pc.index / pc.used;
+                int64_t ia_end = pc.begin + na * (pc.index + 1) / pc.used;
+                int64_t ib = splits[t];
+                int64_t ib_end = pc.index + 1 == pc.used ? pc.end : splits[t + 1];
+                std::merge(std::make_move_iterator(src + ia), std::make_move_iterator(src + ia_end),
+                           std::make_move_iterator(src + ib), std::make_move_iterator(src + ib_end),
+                           dst + ia + (ib - pc.mid), comp);
+            }
+        });
+        std::swap(src, dst);
+    }
+    if (src != first) {
+        pool.parallel_for(n, kGrain, [&](int64_t lo, int64_t hi) {
+            std::move(src + lo, src + hi, first + lo);
+        });
+    }
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        pool.parallel_for(n, kGrain, [&](int64_t lo, int64_t hi) {
+            std::destroy(buffer.get() + lo, buffer.get() + hi);
+        });
+    }
+}
+
+// Параллельная LSD-поразрядная сортировка int по 8 бит за проход
+inline void radix_sort(int* data, int64_t n, ThreadPool& pool = ThreadPool::global()) {
+    constexpr int kBuckets = 256;
+    int64_t blocks = detail::block_count(n, pool);
+    if (n < 2) {
+        return;
+    }
+    auto bound = [&](int64_t b) { return n * b / blocks; };
+    auto key = [](int v, int shift) {
+        return (static_cast<uint32_t>(v) ^ 0x80000000u) >> shift & (kBuckets - 1);
+    };
+
+    std::unique_ptr<int[]> buffer(new int[n]);
+    std::vector<int64_t> offsets(blocks * kBuckets);
+    int* src = data;
+    int* dst = buffer.get();
+    for (int shift = 0; shift < 32; shift += 8) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        pool.parallel_for(blocks, 1, [&](int64_t lo, int64_t hi) {
+            for (int64_t b = lo; b < hi; ++b) {
+                int64_t* hist = &offsets[b * kBuckets];
+                for (int64_t i = bound(b); i < bound(b + 1); ++i) {
+                    ++hist[key(src[i], shift)];
+                }
+            }
+        });
+
+        // Все ключи в одной корзине: проход ничего не меняет
+        bool trivial = false;
+        int64_t position = 0;
+        for (int d = 0; d < kBuckets; ++d) {
+            int64_t bucket_total = 0;
+            for (int64_t b = 0; b < blocks; ++b) {
+                int64_t count = offsets[b * kBuckets + d];
+                offsets[b * kBuckets + d] = position;
+                position += count;
+                bucket_total += count;
+            }
+            trivial = trivial || bucket_total == n;
+        }
+        if (trivial) {
+            continue;
+        }
+
+        pool.parallel_for(blocks, 1, [&](int64_t lo, int64_t hi) {
+            for (int64_t b = lo; b < hi; ++b) {
+                int64_t* next = &offsets[b * kBuckets];
+                for (int64_t i = bound(b); i < bound(b + 1); ++i) {
+                    dst[next[key(src[i], shift)]++] = src[i];
+                }
+            }
+        });
+        std::swap(src, dst);
+    }
+    if (src != data) {
+        pool.parallel_for(n, kGrain, [&](int64_t lo, int64_t hi) {
+            std::copy(src + lo, src + hi, data + lo);
+        });
+    }
+}
+
+inline void sort(DynamicArray& arr, ThreadPool& pool = ThreadPool::global()) {
+    radix_sort(arr.begin(), arr.Size(), pool);
+}
+
+template <typename Compare>
+void sort(DynamicArray& arr, Compare comp, ThreadPool& pool = ThreadPool::global()) {
+    merge_sort(arr.begin(), arr.end(), comp, pool);
+}
+
+template <typename F>
+void for_each(DynamicArray& arr, F f, ThreadPool& pool = ThreadPool::global()) {
+    for_each(arr.begin(), arr.Size(), f, pool);
+}
+
+// out получает размер in; in и out могут совпадать
+template <typename F>
+void transform(const DynamicArray& in, DynamicArray& out, F f, ThreadPool& pool = ThreadPool::global()) {
+    if (&in != &out) {
+        out.resize(in.Size());
+    }
+    transform(in.begin(), in.Size(), out.begin(), f, pool);
+}
+
+inline void inclusive_scan(DynamicArray& arr, ThreadPool& pool = ThreadPool::global()) {
+    inclusive_scan(arr.begin(), arr.Size(), arr.begin(), std::plus<int>(), pool);
+}
+
+// Участки массива обрабатываются на месте, без копирования в новый DynamicArray
+
+inline void sort(ArraySpan span, ThreadPool& pool = ThreadPool::global()) {
+    radix_sort(span.data(), span.Size(), pool);
+}
+
+template <typename F>
+void for_each(ArraySpan span, F f, ThreadPool& pool = ThreadPool::global()) {
+    for_each(span.data(), span.Size(), f, pool);
+}
+
+} // namespace parallel
+
+#endif // PARALLEL_ALGORITHMS_HPP
@@ -0,0 +1,374 @@
+#ifndef PERSISTENT_VECTOR_HPP
+#define PERSISTENT_VECTOR_HPP
+
+#include <initializer_list>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+// Персистентный вектор: 32-арное префиксное дерево по битам индекса с
+// отдельным хвостовым листом. Копия стоит O(1), а push_back, set и
+// pop_back копируют только путь от корня, O(log32 n), разделяя остальные
+// узлы со старыми версиями. Методы изменяют *this, прежние копии остаются
+// нетронутыми. Transient позволяет собирать вектор пакетно, изменяя
+// собственные узлы на месте.
+template <typename T>
+class PersistentVector {
+    static constexpr int kBits = 5;
+    static constexpr int64_t kWidth = int64_t(1) << kBits;
+    static constexpr int64_t kMask = kWidth - 1;
+
+    struct Node {
+        uint64_t edit = 0;  //!< метка транзиента, которому узел принадлежит; 0 — неизменяемый
+    };
+
+    struct Branch : Node {
+        std::shared_ptr<Node> children[kWidth];
+    };
+
+    struct Leaf : Node {
+        T values[kWidth];
+    };
+
+public:
+    class Transient;
+
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() = default;
+        const_iterator(const PersistentVector* owner, int64_t index) : owner_(owner), index_(index) {}
+
+        reference operator*() const { return (*owner_)[index_]; }
+        pointer operator->() const { return &(*owner_)[index_]; }
+        reference operator[](difference_type n) const { return (*owner_)[index_ + n]; }
+
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++index_; return tmp; }
+        const_iterator& operator--() { --index_; return *this; }
+        const_iterator operator--(int) { const_iterator tmp = *this; --index_; return tmp; }
+        const_iterator& operator+=(difference_type n) { index_ += n; return *this; }
+        const_iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+
+        friend const_iterator operator+(const_iterator it, difference_type n) { return it += n; }
+        friend const_iterator operator-(const_iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const const_iterator& a, const const_iterator& b) { return a.index_ - b.index_; }
+        friend bool operator==(const const_iterator& a, const const_iterator& b) { return a.index_ == b.index_; }
+        friend bool operator!=(const const_iterator& a, const const_iterator& b) { return a.index_ != b.index_; }
+        friend bool operator<(const const_iterator& a, const const_iterator& b) { return a.index_ < b.index_; }
+
+    private:
+        const PersistentVector* owner_ = nullptr;
+        int64_t index_ = 0;
+    };
+
+    PersistentVector()
+        : root_(std::make_shared<Branch>()), tail_(std::make_shared<Leaf>()) {}
+
+    PersistentVector(const PersistentVector&) = default;
+    PersistentVector& operator=(const PersistentVector&) = default;
+
+    // Перемещение совпадает с копированием: источник остаётся корректным
+    // вектором, а копия стоит лишь двух счётчиков ссылок
+    PersistentVector(PersistentVector&& other) noexcept
+        : size_(other.size_), shift_(other.shift_), root_(other.root_), tail_(other.tail_) {}
+
+    PersistentVector& operator=(PersistentVector&& rhs) noexcept {
+        PersistentVector tmp(rhs);
+        swap(tmp);
+        return *this;
+    }
+
+    PersistentVector(int64_t size, const T& value = T())
+        : PersistentVector() {
+        if (size < 0) {
+            throw std::invalid_argument("Size cannot be negative");
+        }
+        Transient builder = transient();
+        for (int64_t i = 0; i < size; ++i) {
+            builder.push_back(value);
+        }
+        *this = builder.persistent();
+    }
+
+    PersistentVector(const std::initializer_list<T>& list)
+        : PersistentVector() {
+        Transient builder = transient();
+        for (const auto& item : list) {
+            builder.push_back(item);
+        }
+        *this = builder.persistent();
+    }
+
+    int64_t Size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    const T& operator[](int64_t i) const { return leaf_for(i)->values[i & kMask]; }
+
+    const T& at(int64_t i) const {
+        check_index(i);
+        return (*this)[i];
+    }
+
+    void push_back(const T& value) { push_back_impl(value, 0); }
+    void pop_back() { pop_back_impl(0); }
+    void set(int64_t i, const T& value) { set_impl(i, value, 0); }
+
+    void clear() { *this = PersistentVector(); }
+
+    void swap(PersistentVector& other) noexcept {
+        std::swap(size_, other.size_);
+        std::swap(shift_, other.shift_);
+        root_.swap(other.root_);
+        tail_.swap(other.tail_);
+    }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size_); }
+
+    // Изменяемая копия для пакетной сборки; исходный вектор не меняется
+    Transient transient() const { return Transient(*this); }
+
+    bool operator==(const PersistentVector& rhs) const {
+        if (size_ != rhs.size_) return false;
+        if (root_ == rhs.root_ && tail_ == rhs.tail_) return true;
+        for (int64_t i = 0; i < size_; i += kWidth) {
+            const Leaf* a = leaf_for(i);
+            const Leaf* b = rhs.leaf_for(i);
+            if (a == b) continue;
+            int64_t count = size_ - i < kWidth ? size_ - i : kWidth;
+            for (int64_t k = 0; k < count; ++k) {
+                if (!(a->values[k] == b->values[k])) return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator!=(const PersistentVector& rhs) const {
+        return !(*this == rhs);
+    }
+
+    class Transient {
+    public:
+        // Два транзиента с одной меткой испортили бы узлы друг друга
+        Transient(const Transient&) = delete;
+        Transient& operator=(const Transient&) = delete;
+
+        Transient(Transient&& other) noexcept
+            : vec_(std::move(other.vec_)), edit_(other.edit_) {
+            other.edit_ = 0;
+        }
+
+        int64_t Size() const { return vec_.size_; }
+        bool empty() const { return vec_.size_ == 0; }
+        const T& operator[](int64_t i) const { return vec_[i]; }
+
+        void push_back(const T& value) { vec_.push_back_impl(value, edit()); }
+        void pop_back() { vec_.pop_back_impl(edit()); }
+        void set(int64_t i, const T& value) { vec_.set_impl(i, value, edit()); }
+
+        // Завершает пакетную сборку; после вызова транзиент использовать нельзя
+        PersistentVector persistent() {
+            edit();
+            edit_ = 0;
+            return std::move(vec_);
+        }
+
+    private:
+        friend class PersistentVector;
+
+        explicit Transient(const PersistentVector& source)
+            : vec_(source), edit_(next_edit()) {}
+
+        uint64_t edit() const {
+            if (edit_ == 0) {
+                throw std::logic_error("Transient used after persistent()");
+            }
+            return edit_;
+        }
+
+        static uint64_t next_edit() {
+            static std::atomic<uint64_t> counter{0};
+            return ++counter;
+        }
+
+        PersistentVector vec_;
+        uint64_t edit_;
+    };
+
+private:
+    void check_index(int64_t i) const {
+        if (i < 0 || i >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    // Индекс первого элемента хвоста
+    int64_t tail_offset() const {
+        return size_ < kWidth ? 0 : ((size_ - 1) >> kBits) << kBits;
+    }
+
+    const Leaf* leaf_for(int64_t i) const {
+        if (i >= tail_offset()) {
+            return tail_.get();
+        }
+        const Node* node = root_.get();
+        for (int level = shift_; level > 0; level -= kBits) {
+            node = static_cast<const Branch*>(node)->children[(i >> level) & kMask].get();
+        }
+        return static_cast<const Leaf*>(node);
+    }
+
+    // Узел, который можно менять на месте: свой узел транзиента или копия
+    template <typename N>
+    static std::shared_ptr<N> editable(const std::shared_ptr<N>& node, uint64_t edit) {
+        if (edit != 0 && node->edit == edit) {
+            return node;
+        }
+        auto copy = std::make_shared<N>(*node);
+        copy->edit = edit;
+        return copy;
+    }
+
+    static std::shared_ptr<Node> new_path(int level, std::shared_ptr<Node> node, uint64_t edit) {
+        if (level == 0) {
+            return node;
+        }
+        auto branch = std::make_shared<Branch>();
+        branch->edit = edit;
+        branch->children[0] = new_path(level - kBits, std::move(node), edit);
+        return branch;
+    }
+
+    std::shared_ptr<Branch> push_tail(int level, const std::shared_ptr<Branch>& parent,
+                                      std::shared_ptr<Node> tail, uint64_t edit) {
+        int64_t subidx = ((size_ - 1) >> level) & kMask;
+        auto result = editable(parent, edit);
+        std::shared_ptr<Node> inserted;
+        if (level == kBits) {
+            inserted = std::move(tail);
+        } else if (auto child = std::static_pointer_cast<Branch>(parent->children[subidx])) {
+            inserted = push_tail(level - kBits, child, std::move(tail), edit);
+        } else {
+            inserted = new_path(level - kBits, std::move(tail), edit);
+        }
+        result->children[subidx] = std::move(inserted);
+        return result;
+    }
+
+    void push_back_impl(const T& value, uint64_t edit) {
+        if (size_ - tail_offset() < kWidth) {
+            T copy = value;
+            tail_ = editable(tail_, edit);
+            tail_->values[size_ & kMask] = std::move(copy);
+            ++size_;
+            return;
+        }
+        // Полный хвост переезжает в дерево, новый хвост содержит value
+        auto new_tail = std::make_shared<Leaf>();
+        new_tail->edit = edit;
+        new_tail->values[0] = value;
+
+        std::shared_ptr<Node> full_tail = tail_;
+        if ((size_ >> kBits) > (int64_t(1) << shift_)) {
+            auto new_root = std::make_shared<Branch>();
+            new_root->edit = edit;
+            new_root->children[0] = root_;
+            new_root->children[1] = new_path(shift_, std::move(full_tail), edit);
+            root_ = std::move(new_root);
+            shift_ += kBits;
+        } else {
+            root_ = push_tail(shift_, root_, std::move(full_tail), edit);
+        }
+        tail_ = std::move(new_tail);
+        ++size_;
+    }
+
+    std::shared_ptr<Branch> pop_tail(int level, const std::shared_ptr<Branch>& node, uint64_t edit) {
+        int64_t subidx = ((size_ - 2) >> level) & kMask;
+        if (level > kBits) {
+            auto child = pop_tail(level - kBits, std::static_pointer_cast<Branch>(node->children[subidx]), edit);
+            if (!child && subidx == 0) {
+                return nullptr;
+            }
+            auto result = editable(node, edit);
+            result->children[subidx] = std::move(child);
+            return result;
+        }
+        if (subidx == 0) {
+            return nullptr;
+        }
+        auto result = editable(node, edit);
+        result->children[subidx] = nullptr;
+        return result;
+    }
+
+    void pop_back_impl(uint64_t edit) {
+        if (size_ == 0) {
+            throw std::out_of_range("Cannot pop from an empty array");
+        }
+        if (size_ - tail_offset() > 1 || size_ == 1) {
+            // Лишний элемент остаётся в листе, но лежит за пределами size_
+            --size_;
+            return;
+        }
+        // Хвост опустел: последний лист дерева становится хвостом
+        const Leaf* last = leaf_for(size_ - 2);
+        std::shared_ptr<Leaf> new_tail = std::make_shared<Leaf>(*last);
+        new_tail->edit = edit;
+
+        auto new_root = pop_tail(shift_, root_, edit);
+        if (!new_root) {
+            new_root = std::make_shared<Branch>();
+            new_root->edit = edit;
+        }
+        if (shift_ > kBits && !new_root->children[1]) {
+            new_root = std::static_pointer_cast<Branch>(new_root->children[0]);
+            shift_ -= kBits;
+        }
+        root_ = std::move(new_root);
+        tail_ = std::move(new_tail);
+        --size_;
+    }
+
+    std::shared_ptr<Branch> set_path(int level, const std::shared_ptr<Branch>& node, int64_t i,
+                                     const T& value, uint64_t edit) {
+        auto result = editable(node, edit);
+        int64_t subidx = (i >> level) & kMask;
+        if (level == kBits) {
+            auto leaf = editable(std::static_pointer_cast<Leaf>(node->children[subidx]), edit);
+            leaf->values[i & kMask] = value;
+            result->children[subidx] = std::move(leaf);
+        } else {
+            result->children[subidx] =
+                set_path(level - kBits, std::static_pointer_cast<Branch>(node->children[subidx]), i, value, edit);
+        }
+        return result;
+    }
+
+    void set_impl(int64_t i, const T& value, uint64_t edit) {
+        check_index(i);
+        T copy = value;
+        if (i >= tail_offset()) {
+            tail_ = editable(tail_, edit);
+            tail_->values[i & kMask] = std::move(copy);
+            return;
+        }
+        root_ = set_path(shift_, root_, i, copy, edit);
+    }
+
+    int64_t size_ = 0;                //!< число элементов
+    int shift_ = kBits;               //!< сдвиг для индекса на уровне корня
+    std::shared_ptr<Branch> root_;    //!< корень дерева (без хвоста)
+    std::shared_ptr<Leaf> tail_;      //!< последний, неполный лист
+};
+
+#endif // PERSISTENT_VECTOR_HPP
@@ -0,0 +1,292 @@
+#ifndef SEGMENTED_ARRAY_HPP
+#define SEGMENTED_ARRAY_HPP
+
+#include <initializer_list>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// Массив из блоков фиксированного размера 2^ChunkShift с каталогом блоков.
+// Рост добавляет новый блок и не копирует элементы, поэтому ссылки и
+// указатели на элементы остаются действительными до их удаления;
+// индекс раскладывается на блок и смещение сдвигом и маской.
+template <typename T, int ChunkShift = 10>
+class SegmentedArray {
+    static_assert(ChunkShift > 0 && ChunkShift < 31, "Unsupported chunk size");
+
+public:
+    static constexpr int64_t kChunkSize = int64_t(1) << ChunkShift;
+
+    template <bool Const>
+    class Iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+        using owner_type = std::conditional_t<Const, const SegmentedArray, SegmentedArray>;
+
+        Iterator() = default;
+        Iterator(owner_type* owner, int64_t index) : owner_(owner), index_(index) {}
+
+        // Обычный итератор приводится к константному
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other) : owner_(other.owner_), index_(other.index_) {}
+
+        reference operator*() const { return (*owner_)[index_]; }
+        pointer operator->() const { return &(*owner_)[index_]; }
+        reference operator[](difference_type n) const { return (*owner_)[index_ + n]; }
+
+        Iterator& operator++() { ++index_; return *this; }
+        Iterator operator++(int) { Iterator tmp = *this; ++index_; return tmp; }
+        Iterator& operator--() { --index_; return *this; }
+        Iterator operator--(int) { Iterator tmp = *this; --index_; return tmp; }
+        Iterator& operator+=(difference_type n) { index_ += n; return *this; }
+        Iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+
+        friend Iterator operator+(Iterator it, difference_type n) { return it += n; }
+        friend Iterator operator+(difference_type n, Iterator it) { return it += n; }
+        friend Iterator operator-(Iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const Iterator& a, const Iterator& b) { return a.index_ - b.index_; }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.index_ == b.index_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.index_ != b.index_; }
+        friend bool operator<(const Iterator& a, const Iterator& b) { return a.index_ < b.index_; }
+        friend bool operator>(const Iterator& a, const Iterator& b) { return a.index_ > b.index_; }
+        friend bool operator<=(const Iterator& a, const Iterator& b) { return a.index_ <= b.index_; }
+        friend bool operator>=(const Iterator& a, const Iterator& b) { return a.index_ >= b.index_; }
+
+    private:
+        friend class Iterator<!Const>;
+
+        owner_type* owner_ = nullptr;
+        int64_t index_ = 0;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    // Деструктор не вызывается, если конструктор бросил, поэтому уже
+    // выделенные блоки освобождаются здесь
+    SegmentedArray(int64_t size = 0, const T& value = T()) {
+        if (size < 0) {
+            throw std::invalid_argument("Size cannot be negative");
+        }
+        try {
+            assign(size, value);
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    SegmentedArray(const std::initializer_list<T>& list) {
+        try {
+            reserve(static_cast<int64_t>(list.size()));
+            for (const auto& item : list) {
+                push_back(item);
+            }
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    SegmentedArray(const SegmentedArray& other) {
+        try {
+            reserve(other.size_);
+            for (int64_t c = 0; c * kChunkSize < other.size_; ++c) {
+                int64_t count = std::min(kChunkSize, other.size_ - c * kChunkSize);
+                std::copy(other.chunks_[c], other.chunks_[c] + count, chunks_[c]);
+            }
+        } catch (...) {
+            release();
+            throw;
+        }
+        size_ = other.size_;
+    }
+
+    SegmentedArray(SegmentedArray&& other) noexcept
+        : chunks_(std::move(other.chunks_)), size_(other.size_) {
+        other.chunks_.clear();
+        other.size_ = 0;
+    }
+
+    SegmentedArray& operator=(const SegmentedArray& rhs) {
+        if (this != &rhs) {
+            SegmentedArray tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    SegmentedArray& operator=(SegmentedArray&& rhs) noexcept {
+        if (this != &rhs) {
+            release();
+            chunks_ = std::move(rhs.chunks_);
+            size_ = rhs.size_;
+            rhs.chunks_.clear();
+            rhs.size_ = 0;
+        }
+        return *this;
+    }
+
+    ~SegmentedArray() {
+        release();
+    }
+
+    int64_t Size() const { return size_; }
+    int64_t Capacity() const { return static_cast<int64_t>(chunks_.size()) * kChunkSize; }
+    bool empty() const { return size_ == 0; }
+
+    // Выделяет блоки под new_capacity элементов; существующие элементы не переносятся
+    void reserve(int64_t new_capacity) {
+        if (new_capacity < 0) {
+            throw std::invalid_argument("Capacity cannot be negative");
+        }
+        while (Capacity() < new_capacity) {
+            // Блок принадлежит unique_ptr, пока каталог не примет его: рост каталога может бросить
+            std::unique_ptr<T[]> chunk(new T[kChunkSize]);
+            chunks_.push_back(chunk.get());
+            chunk.release();
+        }
+    }
+
+    // Освобождает блоки, не занятые элементами
+    void shrink_to_fit() {
+        int64_t used = (size_ + kChunkSize - 1) >> ChunkShift;
+        while (static_cast<int64_t>(chunks_.size()) > used) {
+            delete[] chunks_.back();
+            chunks_.pop_back();
+        }
+        chunks_.shrink_to_fit();
+    }
+
+    void push_back(const T& value) {
+        reserve(size_ + 1);  // рост не перемещает элементы, value остаётся действительной
+        (*this)[size_] = value;
+        ++size_;
+    }
+
+    void pop_back() {
+        if (size_ > 0) {
+            --size_;
+        } else {
+            throw std::out_of_range("Cannot pop from an empty array");
+        }
+    }
+
+    void clear() {
+        size_ = 0;
+    }
+
+    void resize(int64_t new_size) {
+        if (new_size < 0) {
+            throw std::invalid_argument("Size cannot be negative");
+        }
+        reserve(new_size);
+        for (int64_t i = size_; i < new_size; ++i) {
+            (*this)[i] = T();
+        }
+        size_ = new_size;
+    }
+
+    void assign(int64_t new_size, const T& value) {
+        if (new_size < 0) {
+            throw std::invalid_argument("Size cannot be negative");
+        }
+        T copy = value;
+        reserve(new_size);
+        for (int64_t i = 0; i < new_size; ++i) {
+            (*this)[i] = copy;
+        }
+        size_ = new_size;
+    }
+
+    // Вставка и удаление сдвигают хвост: O(n), как и у DynamicArray
+    void insert(int64_t index, const T& value) {
+        if (index < 0 || index > size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        T copy = value;
+        push_back(copy);
+        std::move_backward(begin() + index, end() - 1, end());
+        (*this)[index] = std::move(copy);
+    }
+
+    void erase(int64_t index) {
+        if (index < 0 || index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        std::move(begin() + index + 1, end(), begin() + index);
+        --size_;
+    }
+
+    void swap(SegmentedArray& other) {
+        std::swap(chunks_, other.chunks_);
+        std::swap(size_, other.size_);
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, size_); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size_); }
+
+    // Непрерывные участки для обработки блоками (например, векторными ядрами)
+    int64_t chunk_count() const { return (size_ + kChunkSize - 1) >> ChunkShift; }
+    T* chunk_data(int64_t c) { return chunks_[c]; }
+    const T* chunk_data(int64_t c) const { return chunks_[c]; }
+    int64_t chunk_size(int64_t c) const { return std::min(kChunkSize, size_ - (c << ChunkShift)); }
+
+    T& at(int64_t i) {
+        check_index(i);
+        return (*this)[i];
+    }
+
+    const T& at(int64_t i) const {
+        check_index(i);
+        return (*this)[i];
+    }
+
+    T& operator[](int64_t i) { return chunks_[i >> ChunkShift][i & (kChunkSize - 1)]; }
+    const T& operator[](int64_t i) const { return chunks_[i >> ChunkShift][i & (kChunkSize - 1)]; }
+
+    bool operator==(const SegmentedArray& rhs) const {
+        if (size_ != rhs.size_) return false;
+        for (int64_t c = 0; c < chunk_count(); ++c) {
+            if (!std::equal(chunks_[c], chunks_[c] + chunk_size(c), rhs.chunks_[c])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator!=(const SegmentedArray& rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    void check_index(int64_t i) const {
+        if (i < 0 || i >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    void release() {
+        for (T* chunk : chunks_) {
+            delete[] chunk;
+        }
+        chunks_.clear();
+        size_ = 0;
+    }
+
+    std::vector<T*> chunks_;  //!< каталог блоков по kChunkSize элементов
+    int64_t size_ = 0;        //!< число элементов
+};
+
+#endif // SEGMENTED_ARRAY_HPP
@@ -0,0 +1,232 @@
+#ifndef SMALL_DYNAMIC_ARRAY_HPP
+#define SMALL_DYNAMIC_ARRAY_HPP
+
+#include <initializer_list>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Динамический массив с API DynamicArray, первые N элементов которого
+// хранятся внутри объекта; куча используется только при росте сверх N.
+template <typename T, int64_t N = 16>
+class SmallDynamicArray {
+    static_assert(N > 0, "Inline capacity must be positive");
+
+public:
+    SmallDynamicArray(int64_t size = 0, const T& value = T())
+        : size_(size) {
+        if (size < 0) {
+            throw std::invalid_argument("Size cannot be negative");
+        }
+        if (size > N) {
+            data_ = new T[size];
+            capacity_ = size;
+        }
+        std::fill(data_, data_ + size_, value);
+    }
+
+    SmallDynamicArray(const std::initializer_list<T>& list)
+        : SmallDynamicArray() {
+        reallocate(static_cast<int64_t>(list.size()));
+        std::copy(list.begin(), list.end(), data_);
+        size_ = static_cast<int64_t>(list.size());
+    }
+
+    SmallDynamicArray(const SmallDynamicArray& other)
+        : SmallDynamicArray() {
+        reallocate(other.size_);
+        std::copy(other.data_, other.data_ + other.size_, data_);
+        size_ = other.size_;
+    }
+
+    SmallDynamicArray(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_assignable<T>::value)
+        : SmallDynamicArray() {
+        steal(other);
+    }
+
+    SmallDynamicArray& operator=(const SmallDynamicArray& rhs) {
+        if (this != &rhs) {
+            SmallDynamicArray tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    SmallDynamicArray& operator=(SmallDynamicArray&& rhs) noexcept(std::is_nothrow_move_assignable<T>::value) {
+        if (this != &rhs) {
+            release_heap();
+            size_ = 0;
+            steal(rhs);
+        }
+        return *this;
+    }
+
+    ~SmallDynamicArray() {
+        release_heap();
+    }
+
+    int64_t Size() const { return size_; }
+    int64_t Capacity() const { return capacity_; }
+    bool empty() const { return size_ == 0; }
+
+    // Элементы лежат во внутреннем буфере объекта
+    bool is_inline() const { return data_ == inline_; }
+
+    void push_back(const T& value) {
+        if (size_ == capacity_) {
+            T copy = value;  // value может ссылаться на элемент этого массива
+            reallocate(capacity_ * 2);
+            data_[size_++] = std::move(copy);
+            return;
+        }
+        data_[size_++] = value;
+    }
+
+    void pop_back() {
+        if (size_ > 0) {
+            --size_;
+        } else {
+            throw std::out_of_range("Cannot pop from an empty array");
+        }
+    }
+
+    void clear() {
+        size_ = 0;
+    }
+
+    void erase(int64_t index) {
+        if (index < 0 || index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        std::move(data_ + index + 1, data_ + size_, data_ + index);
+        --size_;
+    }
+
+    void resize(int64_t new_size) {
+        if (new_size < 0) {
+            throw std::invalid_argument("Size cannot be negative");
+        }
+        if (new_size > capacity_) {
+            reallocate(new_size);
+        }
+        if (new_size > size_) {
+            std::fill(data_ + size_, data_ + new_size, T());
+        }
+        size_ = new_size;
+    }
+
+    void assign(int64_t new_size, const T& value) {
+        if (new_size < 0) {
+            throw std::invalid_argument("Size cannot be negative");
+        }
+        T copy = value;
+        if (new_size > capacity_) {
+            size_ = 0;
+            reallocate(new_size);
+        }
+        std::fill(data_, data_ + new_size, copy);
+        size_ = new_size;
+    }
+
+    void insert(int64_t index, const T& value) {
+        if (index < 0 || index > size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        T copy = value;
+        if (size_ == capacity_) {
+            reallocate(capacity_ * 2);
+        }
+        std::move_backward(data_ + index, data_ + size_, data_ + size_ + 1);
+        data_[index] = std::move(copy);
+        ++size_;
+    }
+
+    void swap(SmallDynamicArray& other) {
+        if (!is_inline() && !other.is_inline()) {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(capacity_, other.capacity_);
+            return;
+        }
+        SmallDynamicArray tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    T* begin() { return data_; }
+    T* end() { return data_ + size_; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+
+    T& at(int64_t i) {
+        check_index(i);
+        return data_[i];
+    }
+
+    const T& at(int64_t i) const {
+        check_index(i);
+        return data_[i];
+    }
+
+    T& operator[](int64_t i) { return data_[i]; }
+    const T& operator[](int64_t i) const { return data_[i]; }
+
+    bool operator==(const SmallDynamicArray& rhs) const {
+        if (size_ != rhs.size_) return false;
+        return std::equal(data_, data_ + size_, rhs.data_);
+    }
+
+    bool operator!=(const SmallDynamicArray& rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    void check_index(int64_t i) const {
+        if (i < 0 || i >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    // Переносит элементы в буфер ёмкостью не меньше new_capacity
+    void reallocate(int64_t new_capacity) {
+        if (new_capacity <= capacity_) {
+            return;
+        }
+        T* new_data = new T[new_capacity];
+        std::move(data_, data_ + size_, new_data);
+        release_heap();
+        data_ = new_data;
+        capacity_ = new_capacity;
+    }
+
+    void release_heap() {
+        if (!is_inline()) {
+            delete[] data_;
+            data_ = inline_;
+            capacity_ = N;
+        }
+    }
+
+    // Забирает содержимое other; *this должен быть пустым и во внутреннем буфере
+    void steal(SmallDynamicArray& other) {
+        if (other.is_inline()) {
+            std::move(other.data_, other.data_ + other.size_, data_);
+        } else {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_;
+            other.capacity_ = N;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    T inline_[N];             //!< встроенный буфер на первые N элементов
+    T* data_ = inline_;       //!< текущее хранилище (inline_ или куча)
+    int64_t size_ = 0;        //!< число элементов
+    int64_t capacity_ = N;    //!< ёмкость текущего хранилища
+};
+
+#endif // SMALL_DYNAMIC_ARRAY_HPP
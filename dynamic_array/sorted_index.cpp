@@ -0,0 +1,136 @@
+#include "sorted_index.hpp"
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+namespace {
+
+// Число запросов, спускающихся по дереву одновременно
+constexpr int64_t kGroup = 16;
+// 16 int — одна кэш-линия; узел 16k лежит на четыре уровня ниже узла k
+constexpr int64_t kLineInts = 16;
+constexpr size_t kAlignment = 64;
+
+int bit_width(uint64_t v) {
+    return v == 0 ? 0 : 64 - __builtin_clzll(v);
+}
+
+// Снимает с номера узла последние повороты направо: остаётся узел, где
+// спуск последний раз ушёл налево, то есть первый ключ >= искомого
+int64_t resolve(int64_t k) {
+    return k >> __builtin_ffsll(~k);
+}
+
+} // namespace
+
+SortedIndex::SortedIndex(const DynamicArray& keys)
+    : SortedIndex(keys.begin(), keys.Size()) {}
+
+SortedIndex::SortedIndex(const int* keys, int64_t n) {
+    if (n < 0) {
+        throw std::invalid_argument("Size cannot be negative");
+    }
+    if (n >= (int64_t(1) << 32)) {
+        throw std::length_error("Too many keys for SortedIndex");
+    }
+    if (std::is_sorted(keys, keys + n)) {
+        build(keys, n);
+    } else {
+        std::vector<int> sorted(keys, keys + n);
+        std::sort(sorted.begin(), sorted.end());
+        build(sorted.data(), n);
+    }
+}
+
+void SortedIndex::build(const int* sorted, int64_t n) {
+    size_ = n;
+    if (n == 0) {
+        return;
+    }
+    size_t bytes = static_cast<size_t>(n + 1) * sizeof(int);
+    bytes = (bytes + kAlignment - 1) / kAlignment * kAlignment;
+    int* tree = static_cast<int*>(std::aligned_alloc(kAlignment, bytes));
+    if (!tree) {
+        throw std::bad_alloc();
+    }
+    tree_.reset(tree);
+    ranks_.assign(static_cast<size_t>(n + 1), 0);
+
+    // Симметричный обход дерева выдаёт ключи в отсортированном порядке
+    int64_t next = 0;
+    auto fill = [&](auto&& self, int64_t k) -> void {
+        if (k > size_) {
+            return;
+        }
+        self(self, 2 * k);
+        tree_[k] = sorted[next];
+        ranks_[k] = static_cast<uint32_t>(next);
+        ++next;
+        self(self, 2 * k + 1);
+    };
+    fill(fill, 1);
+}
+
+int64_t SortedIndex::Size() const { return size_; }
+bool SortedIndex::empty() const { return size_ == 0; }
+
+int64_t SortedIndex::search(int key) const {
+    const int* tree = tree_.get();
+    int64_t k = 1;
+    while (k <= size_) {
+        __builtin_prefetch(tree + k * kLineInts);
+        k = 2 * k + (tree[k] < key);
+    }
+    return resolve(k);
+}
+
+int64_t SortedIndex::lower_bound(int key) const {
+    int64_t k = search(key);
+    return k == 0 ? size_ : ranks_[k];
+}
+
+bool SortedIndex::contains(int key) const {
+    int64_t k = search(key);
+    return k != 0 && tree_[k] == key;
+}
+
+void SortedIndex::search(const int* keys, int64_t m, int64_t* nodes) const {
+    const int* tree = tree_.get();
+    int depth = bit_width(static_cast<uint64_t>(size_));
+    std::fill(nodes, nodes + m, int64_t(1));
+    // После depth шагов каждый спуск гарантированно вышел за size_
+    for (int level = 0; level < depth; ++level) {
+        for (int64_t j = 0; j < m; ++j) {
+            if (nodes[j] <= size_) {
+                __builtin_prefetch(tree + nodes[j] * kLineInts);
+                nodes[j] = 2 * nodes[j] + (tree[nodes[j]] < keys[j]);
+            }
+        }
+    }
+    for (int64_t j = 0; j < m; ++j) {
+        nodes[j] = resolve(nodes[j]);
+    }
+}
+
+void SortedIndex::lower_bound(const int* keys, int64_t n, int64_t* out) const {
+    int64_t nodes[kGroup];
+    for (int64_t first = 0; first < n; first += kGroup) {
+        int64_t m = std::min(kGroup, n - first);
+        search(keys + first, m, nodes);
+        for (int64_t j = 0; j < m; ++j) {
+            out[first + j] = nodes[j] == 0 ? size_ : ranks_[nodes[j]];
+        }
+    }
+}
+
+void SortedIndex::contains(const int* keys, int64_t n, bool* out) const {
+    int64_t nodes[kGroup];
+    for (int64_t first = 0; first < n; first += kGroup) {
+        int64_t m = std::min(kGroup, n - first);
+        search(keys + first, m, nodes);
+        for (int64_t j = 0; j < m; ++j) {
+            out[first + j] = nodes[j] != 0 && tree_[nodes[j]] == keys[first + j];
+        }
+    }
+}
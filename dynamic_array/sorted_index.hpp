@@ -0,0 +1,54 @@
+#ifndef SORTED_INDEX_HPP
+#define SORTED_INDEX_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include "dynamic_array.hpp"
+
+// Индекс для поиска по отсортированным ключам в раскладке Эйтцингера:
+// ключи лежат в порядке обхода двоичного дерева в ширину (корень — 1,
+// потомки узла k — 2k и 2k+1). Первые уровни дерева всегда в кэше, а 16
+// правнуков узла занимают одну кэш-линию, поэтому спуск без ветвлений
+// заранее подгружает линию на четыре уровня вперёд.
+class SortedIndex {
+public:
+    SortedIndex() = default;
+
+    // Ключи копируются; неотсортированный массив сортируется.
+    // Бросает std::length_error, если ключей не меньше 2^32.
+    explicit SortedIndex(const DynamicArray& keys);
+    SortedIndex(const int* keys, int64_t n);
+
+    int64_t Size() const;
+    bool empty() const;
+
+    // Позиция первого ключа >= key в отсортированном порядке или Size()
+    int64_t lower_bound(int key) const;
+    bool contains(int key) const;
+
+    // Пакетный поиск: спуск идёт одновременно для группы ключей, чтобы
+    // промахи кэша разных запросов перекрывались
+    void lower_bound(const int* keys, int64_t n, int64_t* out) const;
+    void contains(const int* keys, int64_t n, bool* out) const;
+
+private:
+    struct FreeDeleter {
+        void operator()(int* ptr) const { std::free(ptr); }
+    };
+
+    void build(const int* sorted, int64_t n);
+
+    // Номер узла Эйтцингера первого ключа >= key или 0
+    int64_t search(int key) const;
+
+    // То же для m ключей, спуски идут по уровням вместе
+    void search(const int* keys, int64_t m, int64_t* nodes) const;
+
+    int64_t size_ = 0;
+    std::unique_ptr<int[], FreeDeleter> tree_;  //!< ключи с 1-го элемента, начало выровнено по 64 байтам
+    std::vector<uint32_t> ranks_;               //!< позиция ключа узла k в отсортированном порядке
+};
+
+#endif // SORTED_INDEX_HPP
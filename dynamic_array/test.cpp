@@ -1,6 +1,8 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
 #include "dynamic_array.hpp"
+#include <cstdint>
+#include <memory_resource>
 
 TEST_SUITE("Динамический массив") {
     TEST_CASE("Конструкторы") {
@@ -216,4 +218,330 @@ TEST_SUITE("Динамический массив") {
             REQUIRE(product == 5*10*15*20*25);
         }
     }
-}
\ No newline at end of file
+
+    TEST_CASE("Перемещение и передача владения") {
+        {
+            auto src = DynamicArray{1, 2, 3};
+            int* buffer = src.begin();
+
+            auto dst = DynamicArray(std::move(src));
+            REQUIRE(dst.Size() == 3);
+            REQUIRE(dst.begin() == buffer);
+            REQUIRE(src.Size() == 0);
+            REQUIRE(src.Capacity() == 0);
+            REQUIRE(src.begin() == nullptr);
+        }
+
+        {
+            auto src = DynamicArray{7, 8};
+            auto dst = DynamicArray{1, 2, 3, 4};
+            int* buffer = src.begin();
+
+            dst = std::move(src);
+            REQUIRE(dst.Size() == 2);
+            REQUIRE(dst.begin() == buffer);
+            REQUIRE(dst[1] == 8);
+            REQUIRE(src.empty());
+        }
+
+        {
+            auto arr = DynamicArray{4, 5, 6};
+            int64_t cap = arr.Capacity();
+            DynamicArray::Buffer buffer = arr.release();
+
+            REQUIRE(arr.empty());
+            REQUIRE(arr.Capacity() == 0);
+            REQUIRE(buffer.capacity == cap);
+            REQUIRE(buffer.data[2] == 6);
+
+            auto other = DynamicArray{};
+            other.adopt(buffer.data, 3, buffer.capacity);
+            REQUIRE(other.begin() == buffer.data);
+            REQUIRE(other == DynamicArray{4, 5, 6});
+
+            other.push_back(7);
+            REQUIRE(other.Size() == 4);
+            REQUIRE(other[3] == 7);
+        }
+
+        {
+            // Буфер больше порога mmap освобождается по ёмкости из release()
+            DynamicArray arr(20000000);
+            arr.push_back(1);
+            DynamicArray::Buffer buffer = arr.release();
+            REQUIRE(buffer.capacity > 20000000);
+            REQUIRE(buffer.data[20000000] == 1);
+            DynamicArray::deallocate(buffer.data, buffer.capacity);
+        }
+
+        {
+            auto arr = DynamicArray{};
+            int* buffer = DynamicArray::allocate(2);
+            REQUIRE_THROWS_AS(arr.adopt(buffer, 3, 2), std::invalid_argument);
+            REQUIRE_THROWS_AS(arr.adopt(nullptr, 0, 4), std::invalid_argument);
+            DynamicArray::deallocate(buffer, 2);
+        }
+
+        {
+            // Свой буфер: меняется только размер, ёмкость — та же
+            auto arr = DynamicArray{1, 2, 3, 4};
+            int64_t cap = arr.Capacity();
+            arr.adopt(arr.begin(), 2, cap);
+            REQUIRE(arr == DynamicArray{1, 2});
+            REQUIRE(arr.Capacity() == cap);
+            REQUIRE_THROWS_AS(arr.adopt(arr.begin(), 2, cap + 1), std::invalid_argument);
+            REQUIRE_THROWS_AS(arr.adopt(arr.begin(), 1, 1), std::invalid_argument);
+            REQUIRE(arr.Size() == 2);
+        }
+    }
+
+    TEST_CASE("Рост больших массивов") {
+        // 20 млн элементов переходят порог отображения через mmap
+        const int64_t count = 20000000;
+        auto arr = DynamicArray{};
+        for (int64_t i = 0; i < count; ++i)
+            arr.push_back(static_cast<int>(i));
+
+        REQUIRE(arr.Size() == count);
+        REQUIRE(arr[0] == 0);
+        REQUIRE(arr[count / 2] == count / 2);
+        REQUIRE(arr[count - 1] == count - 1);
+
+        arr.insert(1, -1);
+        REQUIRE(arr[1] == -1);
+        REQUIRE(arr[count] == count - 1);
+
+        auto copy = arr;
+        REQUIRE(copy == arr);
+
+        arr.resize(count * 3);
+        REQUIRE(arr[count] == count - 1);
+        REQUIRE(arr[count * 3 - 1] == 0);
+    }
+
+    TEST_CASE("Управление ёмкостью") {
+        {
+            auto arr = DynamicArray{};
+            arr.reserve(100);
+            REQUIRE(arr.Capacity() == 100);
+            REQUIRE(arr.Size() == 0);
+
+            int* buffer = arr.begin();
+            for (int i = 0; i < 100; ++i)
+                arr.push_back(i);
+            REQUIRE(arr.begin() == buffer);
+
+            arr.reserve(10);
+            REQUIRE(arr.Capacity() == 100);
+            REQUIRE_THROWS_AS(arr.reserve(-1), std::invalid_argument);
+        }
+
+        {
+            auto arr = DynamicArray{1, 2, 3, 4, 5, 6, 7, 8};
+            arr.resize(9);
+            REQUIRE(arr.Capacity() == 16);
+            arr.resize(10);
+            REQUIRE(arr.Capacity() == 16);
+            arr.resize(100);
+            REQUIRE(arr.Capacity() == 100);
+        }
+
+        {
+            auto arr = DynamicArray{};
+            arr.set_growth_policy(GrowthPolicy::OneAndHalf);
+            REQUIRE(arr.growth_policy() == GrowthPolicy::OneAndHalf);
+
+            int64_t expected[] = {1, 2, 3, 4, 6, 9, 13, 19};
+            for (int64_t cap : expected) {
+                arr.push_back(0);
+                REQUIRE(arr.Capacity() == cap);
+                while (arr.Size() < arr.Capacity())
+                    arr.push_back(0);
+            }
+        }
+
+        {
+            auto arr = DynamicArray{};
+            arr.set_growth_policy(GrowthPolicy::PageRounded);
+            arr.push_back(1);
+            REQUIRE(arr.Capacity() * sizeof(int) % 4096 == 0);
+
+            auto copy = arr;
+            REQUIRE(copy.growth_policy() == GrowthPolicy::PageRounded);
+        }
+
+        {
+            auto arr = DynamicArray{1, 2, 3};
+            arr.reserve(64);
+            arr.shrink_to_fit();
+            REQUIRE(arr.Capacity() == 3);
+            REQUIRE(arr == DynamicArray{1, 2, 3});
+
+            arr.clear();
+            arr.shrink_to_fit();
+            REQUIRE(arr.Capacity() == 0);
+            REQUIRE(arr.begin() == nullptr);
+
+            arr.push_back(5);
+            REQUIRE(arr[0] == 5);
+        }
+    }
+
+    TEST_CASE("Операции над диапазонами") {
+        {
+            auto arr = DynamicArray{1, 2, 6};
+            int values[] = {3, 4, 5};
+
+            arr.insert(2, values, values + 3);
+            REQUIRE(arr == DynamicArray{1, 2, 3, 4, 5, 6});
+
+            arr.insert(0, values, values);
+            REQUIRE(arr.Size() == 6);
+
+            REQUIRE_THROWS_AS(arr.insert(7, values, values + 1), std::out_of_range);
+        }
+
+        {
+            auto arr = DynamicArray{};
+            int values[] = {7, 8, 9};
+            arr.append(values, values + 3);
+            arr.append(values, values + 1);
+            REQUIRE(arr == DynamicArray{7, 8, 9, 7});
+        }
+
+        {
+            // Вставка собственных элементов при реаллокации
+            auto arr = DynamicArray{1, 2, 3};
+            arr.insert(1, arr.begin(), arr.end());
+            REQUIRE(arr == DynamicArray{1, 1, 2, 3, 2, 3});
+        }
+
+        {
+            auto arr = DynamicArray{0, 1, 2, 3, 4, 5};
+            arr.erase(1, 4);
+            REQUIRE(arr == DynamicArray{0, 4, 5});
+
+            arr.erase(1, 1);
+            REQUIRE(arr.Size() == 3);
+
+            REQUIRE_THROWS_AS(arr.erase(2, 1), std::out_of_range);
+            REQUIRE_THROWS_AS(arr.erase(-1, 1), std::out_of_range);
+            REQUIRE_THROWS_AS(arr.erase(0, 4), std::out_of_range);
+        }
+
+        {
+            auto arr = DynamicArray{1, 2, 3, 4, 5, 6, 7};
+            int64_t removed = arr.remove_if([](int v) { return v % 2 == 0; });
+            REQUIRE(removed == 3);
+            REQUIRE(arr == DynamicArray{1, 3, 5, 7});
+        }
+    }
+
+    TEST_CASE("Рост без инициализации") {
+        {
+            auto arr = DynamicArray{1, 2, 3};
+            arr.resize_for_overwrite(1000);
+            REQUIRE(arr.Size() == 1000);
+            REQUIRE(arr.Capacity() >= 1000);
+            // Старые элементы сохраняются
+            REQUIRE(arr[0] == 1);
+            REQUIRE(arr[2] == 3);
+            for (int64_t i = 3; i < arr.Size(); ++i) {
+                arr[i] = static_cast<int>(i);
+            }
+            REQUIRE(arr[999] == 999);
+
+            arr.resize_for_overwrite(2);
+            REQUIRE(arr == DynamicArray{1, 2});
+            REQUIRE(arr.Capacity() >= 1000);
+            REQUIRE_THROWS_AS(arr.resize_for_overwrite(-1), std::invalid_argument);
+        }
+
+        {
+            DynamicArray arr;
+            arr.resize_for_overwrite(0);
+            REQUIRE(arr.empty());
+            arr.resize_for_overwrite(5);
+            REQUIRE(arr.Capacity() == 5);
+        }
+
+        {
+            auto arr = DynamicArray{7};
+            int* tail = arr.append_uninitialized(3);
+            REQUIRE(arr.Size() == 4);
+            REQUIRE(tail == arr.begin() + 1);
+            tail[0] = 8;
+            tail[1] = 9;
+            tail[2] = 10;
+            REQUIRE(arr == DynamicArray{7, 8, 9, 10});
+
+            int* none = arr.append_uninitialized(0);
+            REQUIRE(none == arr.end());
+            REQUIRE(arr.Size() == 4);
+            REQUIRE_THROWS_AS(arr.append_uninitialized(-1), std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("Выравнивание и huge pages") {
+        auto aligned_to = [](const DynamicArray& arr, uintptr_t alignment) {
+            return reinterpret_cast<uintptr_t>(arr.begin()) % alignment == 0;
+        };
+
+        for (Alignment alignment : {Alignment::CacheLine, Alignment::Page}) {
+            auto bytes = static_cast<uintptr_t>(alignment);
+            DynamicArray arr(3, 7, alignment);
+            REQUIRE(arr.alignment() == alignment);
+            REQUIRE(aligned_to(arr, bytes));
+            REQUIRE(arr == DynamicArray{7, 7, 7});
+
+            // Рост и сжатие идут мимо realloc и сохраняют выравнивание
+            for (int i = 0; i < 10000; ++i) {
+                arr.push_back(i);
+                REQUIRE(aligned_to(arr, bytes));
+            }
+            arr.resize(5);
+            arr.shrink_to_fit();
+            REQUIRE(aligned_to(arr, bytes));
+            REQUIRE(arr == DynamicArray{7, 7, 7, 0, 1});
+
+            DynamicArray copy(arr);
+            REQUIRE(copy.alignment() == alignment);
+            REQUIRE(aligned_to(copy, bytes));
+        }
+
+        {
+            auto arr = DynamicArray{1, 2, 3};
+            arr.set_storage(Alignment::Page, true);
+            REQUIRE(arr.alignment() == Alignment::Page);
+            REQUIRE(arr.huge_pages());
+            REQUIRE(aligned_to(arr, 4096));
+            REQUIRE(arr == DynamicArray{1, 2, 3});
+
+            DynamicArray other;
+            other.swap(arr);
+            REQUIRE(other.alignment() == Alignment::Page);
+            REQUIRE(arr.alignment() == Alignment::Default);
+        }
+
+        {
+            // Большой буфер отображается через mmap и получает MADV_HUGEPAGE
+            int64_t n = (int64_t(80) << 20) / static_cast<int64_t>(sizeof(int));
+            DynamicArray big(n, 1, Alignment::CacheLine, true);
+            REQUIRE(aligned_to(big, 4096));
+            big.push_back(2);
+            REQUIRE(big[n] == 2);
+            REQUIRE(big[n - 1] == 1);
+        }
+
+        {
+            // Выравнивание передаётся и ресурсу
+            std::pmr::monotonic_buffer_resource pool;
+            DynamicArray arr(0, 0, &pool);
+            arr.set_storage(Alignment::CacheLine);
+            arr.push_back(1);
+            REQUIRE(aligned_to(arr, 64));
+        }
+
+        REQUIRE_THROWS_AS(DynamicArray(-1, 0, Alignment::Page), std::invalid_argument);
+    }
+}
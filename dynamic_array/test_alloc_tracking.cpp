@@ -0,0 +1,134 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "alloc_tracking.hpp"
+#include "dynamic_array.hpp"
+#include "../hash_table/hash_table.hpp"
+#include "../stack_base_prj/stack_arr_t.hpp"
+#include "../stack_base_prj/stack_lst_t.hpp"
+#include "../kr_1/dequeue.hpp"
+#include <string>
+
+#ifndef TRACK_ALLOCATIONS
+#error "test_alloc_tracking собирается с TRACK_ALLOCATIONS"
+#endif
+
+using alloc_tracking::counters;
+
+TEST_SUITE("Учёт выделений") {
+    TEST_CASE("DynamicArray: рост, копии и освобождение") {
+        alloc_tracking::reset();
+        {
+            DynamicArray arr;
+            for (int i = 0; i < 100; ++i) {
+                arr.push_back(i);
+            }
+            DynamicArray copy(arr);
+            copy = arr;
+        }
+        auto c = counters("DynamicArray");
+        REQUIRE(c.allocations > 1);
+        REQUIRE(c.allocations == c.frees);
+        REQUIRE(c.bytes_allocated == c.bytes_freed);
+        REQUIRE(c.live_bytes == 0);
+        REQUIRE(c.peak_bytes >= 2 * 100 * static_cast<int64_t>(sizeof(int)));
+        REQUIRE(c.reallocations > 0);
+        REQUIRE(c.copies == 2);
+        REQUIRE(c.bytes_copied == 2 * 100 * static_cast<int64_t>(sizeof(int)));
+    }
+
+    TEST_CASE("release и adopt передают учёт вместе с буфером") {
+        alloc_tracking::reset();
+        DynamicArray arr(10);
+        DynamicArray::Buffer buffer = arr.release();
+        REQUIRE(counters("DynamicArray").live_bytes == 0);
+        arr.adopt(buffer.data, 10, buffer.capacity);
+        REQUIRE(counters("DynamicArray").live_bytes == 10 * static_cast<int64_t>(sizeof(int)));
+    }
+
+    TEST_CASE("Остальные контейнеры") {
+        alloc_tracking::reset();
+        {
+            HashTable<int, int> ht(2);
+            for (int i = 0; i < 50; ++i) {
+                ht.insert(i, i);
+            }
+            HashTable<int, int> copy(ht);
+
+            StackArrT<int> arr_stack;
+            StackLstT<int> lst_stack;
+            for (int i = 0; i < 20; ++i) {
+                arr_stack.push(i);
+                lst_stack.push(i);
+            }
+            StackLstT<int> lst_copy(lst_stack);
+
+            Dequeue dq(8);
+            Dequeue dq_copy(dq);
+        }
+        for (const char* name : {"HashTable", "StackArrT", "StackLstT", "Dequeue"}) {
+            CAPTURE(name);
+            auto c = counters(name);
+            REQUIRE(c.allocations > 0);
+            REQUIRE(c.allocations == c.frees);
+            REQUIRE(c.live_bytes == 0);
+            REQUIRE(c.peak_bytes > 0);
+        }
+        REQUIRE(counters("HashTable").reallocations > 0);
+        REQUIRE(counters("HashTable").copies == 1);
+        REQUIRE(counters("StackArrT").reallocations == 5);
+        REQUIRE(counters("StackLstT").allocations == 6);   // 20 узлов: блоки на 4, 8 и 16 у каждого стека
+        REQUIRE(counters("Dequeue").copies == 1);
+    }
+
+    TEST_CASE("Выделения относятся к области вызывающего кода") {
+        alloc_tracking::reset();
+        {
+            ALLOC_TRACK_SCOPE("loader");
+            DynamicArray arr;
+            for (int i = 0; i < 100; ++i) {
+                arr.push_back(i);
+            }
+            {
+                ALLOC_TRACK_SCOPE("index");
+                HashTable<int, int> ht(2);
+                ht.insert(1, 1);
+                DynamicArray copy(arr);
+            }
+            arr.push_back(0);
+        }
+        DynamicArray outside(4);
+
+        auto loader = counters("DynamicArray", "loader");
+        REQUIRE(loader.allocations > 1);
+        REQUIRE(loader.reallocations > 0);
+        REQUIRE(loader.copies == 0);
+        REQUIRE(counters("DynamicArray", "index").copies == 1);
+        REQUIRE(counters("HashTable", "index").allocations > 0);
+        REQUIRE(counters("HashTable", "loader").allocations == 0);
+        REQUIRE(alloc_tracking::Scope::current() == nullptr);
+
+        std::string report = alloc_tracking::report_json();
+        REQUIRE(report.find("{\"scope\": \"loader\", \"container\": \"DynamicArray\"") != std::string::npos);
+        REQUIRE(report.find("{\"scope\": null, \"container\": \"DynamicArray\"") != std::string::npos);
+    }
+
+    TEST_CASE("JSON-отчёт") {
+        alloc_tracking::reset();
+        std::string empty = alloc_tracking::report_json();
+        REQUIRE(empty.find("\"enabled\": true") != std::string::npos);
+        REQUIRE(empty.find("\"containers\": {}") != std::string::npos);
+        REQUIRE(empty.find("\"scopes\": []") != std::string::npos);
+        REQUIRE(empty.find("\"sites\": []") != std::string::npos);
+
+        {
+            DynamicArray arr;
+            arr.push_back(1);
+            arr.push_back(2);
+        }
+        std::string report = alloc_tracking::report_json();
+        REQUIRE(report.find("\"DynamicArray\": {\"allocations\": 2") != std::string::npos);
+        REQUIRE(report.find("\"file\": \"dynamic_array.cpp\"") != std::string::npos);
+        REQUIRE(report.find("\"function\": \"reallocate\"") != std::string::npos);
+        REQUIRE(counters("Unknown").allocations == 0);
+    }
+}
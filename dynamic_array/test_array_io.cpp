@@ -0,0 +1,143 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "array_io.hpp"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+std::string temp_path(const char* name) {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+std::vector<char> read_bytes(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void write_bytes(const std::string& path, const std::vector<char>& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+} // namespace
+
+TEST_SUITE("Двоичная запись и чтение массива") {
+    TEST_CASE("save и load") {
+        auto path = temp_path("array_io_roundtrip.bin");
+        DynamicArray arr(1000);
+        for (int64_t i = 0; i < arr.Size(); ++i) {
+            arr[i] = static_cast<int>(i * 7 - 300);
+        }
+        array_io::save(path, arr);
+        REQUIRE(std::filesystem::file_size(path) == 64 + 1000 * sizeof(int));
+
+        auto info = array_io::read_info(path);
+        REQUIRE(info.type == array_io::ElementType::Int32);
+        REQUIRE(info.byte_order == array_io::native_byte_order());
+        REQUIRE(info.count == 1000);
+
+        DynamicArray loaded = array_io::load(path);
+        REQUIRE(loaded == arr);
+        REQUIRE(loaded.Capacity() == 1000);
+
+        array_io::save(path, DynamicArray());
+        REQUIRE(array_io::load(path).empty());
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Потоковая запись мелкими и крупными порциями") {
+        auto path = temp_path("array_io_stream.bin");
+        std::vector<int> expected;
+        {
+            array_io::Writer writer(path);
+            for (int i = 0; i < 100; ++i) {
+                writer.write(i);
+                expected.push_back(i);
+            }
+            // Больше внутреннего буфера: пишется напрямую вместе с буфером
+            std::vector<int> big(600000);
+            for (size_t i = 0; i < big.size(); ++i) {
+                big[i] = static_cast<int>(i ^ 0x5a5a);
+            }
+            writer.write(big.data(), static_cast<int64_t>(big.size()));
+            expected.insert(expected.end(), big.begin(), big.end());
+            for (int chunk = 0; chunk < 50; ++chunk) {
+                writer.write(big.data() + chunk * 1000, 1000);
+                expected.insert(expected.end(), big.begin() + chunk * 1000, big.begin() + chunk * 1000 + 1000);
+            }
+            REQUIRE(writer.count() == static_cast<int64_t>(expected.size()));
+            // Заголовок дописывает деструктор
+        }
+        DynamicArray loaded = array_io::load(path);
+        REQUIRE(loaded.Size() == static_cast<int64_t>(expected.size()));
+        REQUIRE(std::equal(loaded.begin(), loaded.end(), expected.begin()));
+
+        array_io::Writer finished(path);
+        finished.finish();
+        REQUIRE_THROWS_AS(finished.write(1), std::logic_error);
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Чтение через отображение в память") {
+        auto path = temp_path("array_io_mapped.bin");
+        DynamicArray arr{5, 4, 3, 2, 1};
+        array_io::save(path, arr);
+
+        array_io::MappedFile file(path);
+        REQUIRE(file.Size() == 5);
+        REQUIRE(file[0] == 5);
+        REQUIRE(file.at(4) == 1);
+        REQUIRE_THROWS_AS(file.at(5), std::out_of_range);
+        REQUIRE(reinterpret_cast<uintptr_t>(file.begin()) % 64 == 0);
+        REQUIRE(file.view() == ArrayView(arr));
+
+        array_io::MappedFile moved(std::move(file));
+        REQUIRE(moved.Size() == 5);
+        REQUIRE(file.empty());
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Файл с другим порядком байтов") {
+        auto path = temp_path("array_io_swapped.bin");
+        DynamicArray arr{1, -2, 0x01020304};
+        array_io::save(path, arr);
+
+        // Переписываем файл так, как его сохранила бы машина с другим порядком байтов
+        auto bytes = read_bytes(path);
+        bool little = array_io::native_byte_order() == array_io::ByteOrder::Little;
+        bytes[10] = static_cast<char>(little ? array_io::ByteOrder::Big : array_io::ByteOrder::Little);
+        std::reverse(bytes.begin() + 16, bytes.begin() + 24);
+        for (size_t offset = 64; offset < bytes.size(); offset += 4) {
+            std::reverse(bytes.begin() + offset, bytes.begin() + offset + 4);
+        }
+        write_bytes(path, bytes);
+
+        REQUIRE(array_io::read_info(path).count == 3);
+        REQUIRE(array_io::load(path) == arr);
+        REQUIRE_THROWS_AS(array_io::MappedFile{path}, std::runtime_error);
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Ошибки формата") {
+        auto path = temp_path("array_io_bad.bin");
+        REQUIRE_THROWS_AS(array_io::load(path), std::system_error);
+
+        write_bytes(path, std::vector<char>(100, 'x'));
+        REQUIRE_THROWS_AS(array_io::load(path), std::runtime_error);
+
+        array_io::save(path, DynamicArray(10, 1));
+        auto bytes = read_bytes(path);
+        bytes.resize(bytes.size() - 4);
+        write_bytes(path, bytes);
+        REQUIRE_THROWS_AS(array_io::load(path), std::runtime_error);
+        REQUIRE_THROWS_AS(array_io::MappedFile{path}, std::runtime_error);
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,119 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "array_view.hpp"
+#include "dynamic_array_simd.hpp"
+#include "parallel_algorithms.hpp"
+#include <algorithm>
+#include <numeric>
+
+TEST_SUITE("Представления массива") {
+    TEST_CASE("Подучастки без копирования") {
+        DynamicArray arr{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        ArrayView view = arr;
+        REQUIRE(view.Size() == 10);
+        REQUIRE(view.data() == arr.begin());
+
+        ArrayView middle = view.subview(3, 4);
+        REQUIRE(middle.Size() == 4);
+        REQUIRE(middle[0] == 3);
+        REQUIRE(middle.at(3) == 6);
+        REQUIRE(middle.data() == arr.begin() + 3);
+        REQUIRE(view.subview(7) == ArrayView(arr.begin() + 7, 3));
+        REQUIRE(view.subview(10).empty());
+
+        REQUIRE_THROWS_AS(middle.at(4), std::out_of_range);
+        REQUIRE_THROWS_AS(view.subview(8, 3), std::out_of_range);
+        REQUIRE_THROWS_AS(view.subview(-1, 1), std::out_of_range);
+        REQUIRE_THROWS_AS(ArrayView(arr.begin(), -1), std::invalid_argument);
+
+        ArraySpan span = arr;
+        span.subview(0, 2)[1] = 100;
+        REQUIRE(arr[1] == 100);
+        ArrayView from_span = span;
+        REQUIRE(from_span == view);
+    }
+
+    TEST_CASE("Шаговые представления") {
+        DynamicArray arr{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        StridedView even = ArrayView(arr).strided(2);
+        REQUIRE(even.Size() == 5);
+        REQUIRE(even[4] == 8);
+        REQUIRE(std::accumulate(even.begin(), even.end(), 0) == 20);
+        REQUIRE(ArrayView(arr).strided(3).Size() == 4);
+        REQUIRE(even.subview(1, 2)[1] == 4);
+        REQUIRE_THROWS_AS(even.at(5), std::out_of_range);
+        REQUIRE_THROWS_AS(ArrayView(arr).strided(0), std::invalid_argument);
+
+        StridedSpan odd = ArraySpan(arr).subview(1).strided(2);
+        for (int& value : odd) {
+            value = -value;
+        }
+        REQUIRE(arr[1] == -1);
+        REQUIRE(arr[9] == -9);
+        REQUIRE(arr[2] == 2);
+    }
+
+    TEST_CASE("Стандартные алгоритмы над шаговыми представлениями") {
+        DynamicArray arr{9, 0, 7, 0, 5, 0, 3, 0, 1, 0};
+        StridedSpan even = ArraySpan(arr).strided(2);
+        std::sort(even.begin(), even.end());
+        REQUIRE(arr == DynamicArray{1, 0, 3, 0, 5, 0, 7, 0, 9, 0});
+
+        StridedView view = even;
+        auto it = std::lower_bound(view.begin(), view.end(), 6);
+        REQUIRE(it - view.begin() == 3);
+        REQUIRE(*it == 7);
+        REQUIRE(std::binary_search(view.begin(), view.end(), 5));
+
+        StridedView::iterator first = even.begin();
+        StridedSpan::const_iterator last = even.cend();
+        REQUIRE(last - first == 5);
+        REQUIRE(2 + first == first + 2);
+        REQUIRE(first < last);
+        REQUIRE(last > first);
+        REQUIRE(first <= first);
+        REQUIRE(last >= first);
+        REQUIRE(std::is_sorted(view.begin(), view.end()));
+    }
+
+    TEST_CASE("Разбиение на части") {
+        DynamicArray arr(10, 1);
+        auto pieces = ArrayView(arr).chunks(4);
+        REQUIRE(pieces.size() == 4);
+        REQUIRE(pieces[0].Size() == 3);
+        REQUIRE(pieces[1].Size() == 3);
+        REQUIRE(pieces[2].Size() == 2);
+        REQUIRE(pieces[3].Size() == 2);
+        REQUIRE(pieces[3].end() == arr.end());
+        REQUIRE(ArrayView(arr).chunks(20)[19].empty());
+        REQUIRE_THROWS_AS(ArrayView(arr).chunks(0), std::invalid_argument);
+    }
+
+    TEST_CASE("Алгоритмы принимают представления") {
+        DynamicArray arr(1000);
+        for (int64_t i = 0; i < arr.Size(); ++i) {
+            arr[i] = static_cast<int>(i % 100);
+        }
+        ArrayView tail = ArrayView(arr).subview(900);
+        REQUIRE(simd::sum(tail) == 4950);
+        REQUIRE(simd::min_max(tail).max == 99);
+        REQUIRE(simd::count(tail, 7) == 1);
+        REQUIRE(simd::find(tail, 42) == 42);
+        REQUIRE(simd::find(tail, 1000) == -1);
+        REQUIRE(simd::equal(tail, ArrayView(arr).subview(0, 100)));
+        REQUIRE_FALSE(simd::equal(tail, ArrayView(arr).subview(1, 100)));
+        REQUIRE_THROWS_AS(simd::min_max(tail.subview(0, 0)), std::out_of_range);
+
+        simd::fill(ArraySpan(arr).subview(10, 5), -1);
+        REQUIRE(simd::count(arr, -1) == 5);
+        REQUIRE(arr[9] == 9);
+        REQUIRE(arr[15] == 15);
+
+        ArraySpan part = ArraySpan(arr).subview(100, 100);
+        parallel::sort(part);
+        REQUIRE(std::is_sorted(part.begin(), part.end()));
+        parallel::for_each(part, [](int& value) { value += 1; });
+        REQUIRE(arr[100] == 1);
+        REQUIRE(arr[99] == 99);
+    }
+}
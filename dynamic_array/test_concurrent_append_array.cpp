@@ -0,0 +1,221 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "concurrent_append_array.hpp"
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Корзины выделяются через new[]: считаем такие выделения и освобождения.
+// Санитайзеры подменяют new[] своим, под ними утечки ловят они сами
+#if defined(__SANITIZE_THREAD__) || defined(__SANITIZE_ADDRESS__)
+constexpr bool kCountArrayNew = false;
+#else
+constexpr bool kCountArrayNew = true;
+#endif
+
+static std::atomic<int64_t> array_news{0};
+static std::atomic<int64_t> array_deletes{0};
+
+void* operator new[](std::size_t bytes) {
+    array_news.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(bytes ? bytes : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete[](void* p) noexcept {
+    if (p) {
+        array_deletes.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    operator delete[](p);
+}
+
+// Элемент, который считает живые экземпляры
+struct Tracked {
+    static std::atomic<int64_t> live;
+
+    int64_t value;
+
+    explicit Tracked(int64_t v) : value(v) { live.fetch_add(1, std::memory_order_relaxed); }
+    Tracked(const Tracked& other) : value(other.value) { live.fetch_add(1, std::memory_order_relaxed); }
+    ~Tracked() { live.fetch_sub(1, std::memory_order_relaxed); }
+};
+
+std::atomic<int64_t> Tracked::live{0};
+
+TEST_SUITE("Параллельное добавление") {
+    TEST_CASE("Однопоточное использование") {
+        ConcurrentAppendArray<std::string> arr;
+        REQUIRE(arr.empty());
+        for (int i = 0; i < 1000; ++i) {
+            REQUIRE(arr.push_back(std::to_string(i)) == i);
+        }
+        REQUIRE(arr.Size() == 1000);
+        REQUIRE(arr[999] == "999");
+        REQUIRE(arr.at(31) == "31");
+        REQUIRE(arr.at(32) == "32");
+        REQUIRE_THROWS_AS(arr.at(1000), std::out_of_range);
+        REQUIRE_FALSE(arr.is_published(-1));
+
+        int64_t visited = 0;
+        arr.for_each([&](int64_t index, const std::string& value) {
+            REQUIRE(value == std::to_string(index));
+            ++visited;
+        });
+        REQUIRE(visited == 1000);
+    }
+
+    TEST_CASE("Элементы не перемещаются при росте") {
+        ConcurrentAppendArray<int> arr;
+        arr.push_back(1);
+        const int* first = &arr[0];
+        for (int i = 0; i < 100000; ++i) {
+            arr.push_back(i);
+        }
+        REQUIRE(&arr[0] == first);
+        REQUIRE(*first == 1);
+
+        ConcurrentAppendArray<int> reserved;
+        reserved.reserve(5000);
+        REQUIRE(reserved.empty());
+        REQUIRE_THROWS_AS(reserved.reserve(-1), std::invalid_argument);
+    }
+
+    TEST_CASE("Элементы с владением освобождаются") {
+        auto counter = std::make_shared<int>(0);
+        {
+            ConcurrentAppendArray<std::shared_ptr<int>> arr;
+            for (int i = 0; i < 100; ++i) {
+                arr.push_back(counter);
+            }
+            REQUIRE(counter.use_count() == 101);
+        }
+        REQUIRE(counter.use_count() == 1);
+    }
+
+    TEST_CASE("Потоки одновременно пересекают границы корзин") {
+        // 32 * (2^12 - 1) элементов: корзины 0..11 заполняются все разом
+        const int writers = 8;
+        const int64_t total = 32 * ((int64_t(1) << 12) - 1);
+        ConcurrentAppendArray<int64_t> arr;
+        std::atomic<int> ready{0};
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < writers; ++t) {
+            threads.emplace_back([&] {
+                ready.fetch_add(1);
+                while (ready.load() < writers) {
+                    std::this_thread::yield();
+                }
+                for (int64_t i = 0; i < total / writers; ++i) {
+                    int64_t index = arr.push_back(0);
+                    arr[index] = index;
+                }
+            });
+        }
+        for (auto& th : threads) {
+            th.join();
+        }
+
+        REQUIRE(arr.Size() == total);
+        int64_t visited = 0;
+        arr.for_each([&](int64_t index, int64_t value) {
+            REQUIRE(value == index);
+            ++visited;
+        });
+        REQUIRE(visited == total);
+        REQUIRE(arr.is_published(total - 1));
+        REQUIRE_FALSE(arr.is_published(total));
+    }
+
+    TEST_CASE("Писатели и читатель одновременно") {
+        const int writers = 4;
+        const int per_writer = 20000;
+        ConcurrentAppendArray<int64_t> arr;
+        std::atomic<bool> done{false};
+
+        std::thread reader([&] {
+            while (!done.load()) {
+                arr.for_each([&](int64_t, int64_t value) {
+                    REQUIRE(value >= 0);
+                });
+            }
+        });
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < writers; ++t) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < per_writer; ++i) {
+                    arr.push_back(int64_t(t) * per_writer + i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        done = true;
+        reader.join();
+
+        REQUIRE(arr.Size() == writers * per_writer);
+        std::vector<bool> seen(writers * per_writer, false);
+        arr.for_each([&](int64_t, int64_t value) {
+            REQUIRE_FALSE(seen[value]);
+            seen[value] = true;
+        });
+        for (bool flag : seen) {
+            REQUIRE(flag);
+        }
+    }
+
+    TEST_CASE("Под нагрузкой корзины не теряются и не утекают") {
+        const int writers = 16;
+        const int per_writer = 50000;
+        int64_t news_before = array_news.load();
+        int64_t deletes_before = array_deletes.load();
+        {
+            ConcurrentAppendArray<Tracked> arr;
+            std::atomic<int> ready{0};
+
+            std::vector<std::thread> threads;
+            for (int t = 0; t < writers; ++t) {
+                threads.emplace_back([&, t] {
+                    ready.fetch_add(1);
+                    while (ready.load() < writers) {
+                        std::this_thread::yield();
+                    }
+                    for (int i = 0; i < per_writer; ++i) {
+                        arr.emplace_back(int64_t(t) * per_writer + i);
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            REQUIRE(arr.Size() == int64_t(writers) * per_writer);
+            REQUIRE(Tracked::live.load() == int64_t(writers) * per_writer);
+
+            std::vector<bool> seen(writers * per_writer, false);
+            arr.for_each([&](int64_t, const Tracked& item) {
+                REQUIRE_FALSE(seen[item.value]);
+                seen[item.value] = true;
+            });
+            for (bool flag : seen) {
+                REQUIRE(flag);
+            }
+        }
+        REQUIRE(Tracked::live.load() == 0);
+        // Корзины проигравших в гонке освобождены, опубликованные — вместе с массивом
+        if (kCountArrayNew) {
+            REQUIRE(array_news.load() - news_before == array_deletes.load() - deletes_before);
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "cow_dynamic_array.hpp"
+#include "dynamic_array_simd.hpp"
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+TEST_SUITE("Копирование при записи") {
+    TEST_CASE("Копии разделяют буфер до первого изменения") {
+        CowDynamicArray arr{1, 2, 3};
+        CowDynamicArray copy = arr;
+
+        REQUIRE(arr.is_shared());
+        REQUIRE(copy.use_count() == 2);
+        const auto& carr = arr;
+        const auto& ccopy = copy;
+        REQUIRE(carr.begin() == ccopy.begin());
+
+        copy.push_back(4);
+        REQUIRE_FALSE(arr.is_shared());
+        REQUIRE(arr.Size() == 3);
+        REQUIRE(copy.Size() == 4);
+        REQUIRE(carr.begin() != ccopy.begin());
+    }
+
+    TEST_CASE("Запись через operator[] отделяет копию") {
+        CowDynamicArray arr{5, 6, 7};
+        auto snap = arr.snapshot();
+
+        arr[0] = 50;
+        REQUIRE(arr[0] == 50);
+        REQUIRE(snap[0] == 5);
+
+        auto snap2 = arr.snapshot();
+        arr.erase(0);
+        REQUIRE(arr == CowDynamicArray{6, 7});
+        REQUIRE(snap2 == CowDynamicArray{50, 6, 7});
+    }
+
+    TEST_CASE("Передача DynamicArray без копирования и пустые массивы") {
+        DynamicArray source{9, 8, 7};
+        const int* buffer = source.begin();
+
+        CowDynamicArray arr(std::move(source));
+        REQUIRE(arr.get().begin() == buffer);
+        REQUIRE(simd::sum(arr.get()) == 24);
+        static_assert(std::is_same<decltype(arr.get()[0]), const int&>::value,
+                      "get() must not expose the shared buffer for writing");
+        static_assert(std::is_same<decltype(arr.get().at(0)), const int&>::value,
+                      "get() must not expose the shared buffer for writing");
+
+        CowDynamicArray moved = std::move(arr);
+        REQUIRE(arr.empty());
+        REQUIRE(arr.Size() == 0);
+        arr.push_back(1);
+        REQUIRE(arr == CowDynamicArray{1});
+        REQUIRE(CowDynamicArray() == CowDynamicArray{});
+        REQUIRE_THROWS_AS(CowDynamicArray().at(0), std::out_of_range);
+    }
+
+    TEST_CASE("Снимки для читающих потоков") {
+        CowDynamicArray arr(100000, 1);
+        std::vector<std::thread> readers;
+        std::vector<int64_t> sums(4);
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([snap = arr.snapshot(), &sums, t] {
+                sums[t] = simd::sum(snap.get());
+            });
+        }
+        arr.assign(100000, 2);
+        for (auto& reader : readers)
+            reader.join();
+
+        for (int64_t s : sums)
+            REQUIRE(s == 100000);
+        REQUIRE(simd::sum(arr.get()) == 200000);
+    }
+}
@@ -0,0 +1,95 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "dynamic_array_simd.hpp"
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+// Прогоняет проверку на всех уровнях, доступных процессору
+template <typename Check>
+void for_each_level(Check check) {
+    for (auto level : {simd::Level::Scalar, simd::Level::SSE42, simd::Level::AVX2}) {
+        if (level > simd::detected_level()) {
+            continue;
+        }
+        simd::set_level(level);
+        CAPTURE(static_cast<int>(level));
+        check();
+    }
+    simd::set_level(simd::detected_level());
+}
+
+DynamicArray make_sequence(int64_t n) {
+    DynamicArray arr(n);
+    for (int64_t i = 0; i < n; ++i)
+        arr[i] = static_cast<int>((i * 7919) % 1000) - 500;
+    return arr;
+}
+
+} // namespace
+
+TEST_SUITE("Векторные алгоритмы") {
+    TEST_CASE("Сумма") {
+        for_each_level([] {
+            for (int64_t n : {0, 1, 3, 4, 7, 8, 9, 17, 1000, 1027}) {
+                auto arr = make_sequence(n);
+                REQUIRE(simd::sum(arr) == std::accumulate(arr.begin(), arr.end(), int64_t(0)));
+            }
+
+            DynamicArray big(100, 2000000000);
+            REQUIRE(simd::sum(big) == int64_t(2000000000) * 100);
+        });
+    }
+
+    TEST_CASE("Минимум и максимум") {
+        for_each_level([] {
+            for (int64_t n : {1, 3, 8, 9, 31, 1000}) {
+                auto arr = make_sequence(n);
+                auto mm = simd::min_max(arr);
+                REQUIRE(mm.min == *std::min_element(arr.begin(), arr.end()));
+                REQUIRE(mm.max == *std::max_element(arr.begin(), arr.end()));
+            }
+            REQUIRE_THROWS_AS(simd::min_max(DynamicArray{}), std::out_of_range);
+        });
+    }
+
+    TEST_CASE("Подсчёт и поиск") {
+        for_each_level([] {
+            auto arr = make_sequence(1003);
+            for (int value : {-500, 0, 499, 12345}) {
+                REQUIRE(simd::count(arr, value) == std::count(arr.begin(), arr.end(), value));
+
+                auto it = std::find(arr.begin(), arr.end(), value);
+                int64_t expected = it == arr.end() ? -1 : it - arr.begin();
+                REQUIRE(simd::find(arr, value) == expected);
+            }
+
+            auto tail = DynamicArray(21, 1);
+            tail[20] = 5;
+            REQUIRE(simd::find(tail, 5) == 20);
+            REQUIRE(simd::find(DynamicArray{}, 5) == -1);
+        });
+    }
+
+    TEST_CASE("Сравнение и заполнение") {
+        for_each_level([] {
+            auto a = make_sequence(37);
+            auto b = a;
+            REQUIRE(a == b);
+
+            for (int64_t i : {0, 8, 35, 36}) {
+                auto c = a;
+                c[i] += 1;
+                REQUIRE(a != c);
+            }
+
+            a.assign(29, 7);
+            REQUIRE(a.Size() == 29);
+            REQUIRE(simd::count(a, 7) == 29);
+
+            a.resize(40);
+            REQUIRE(simd::count(a, 0) == 11);
+        });
+    }
+}
@@ -0,0 +1,100 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "gap_array.hpp"
+#include <random>
+#include <string>
+#include <vector>
+
+TEST_SUITE("Массив с разрывом") {
+    TEST_CASE("Базовые операции") {
+        GapArray<int> arr{1, 2, 3};
+        REQUIRE(arr.Size() == 3);
+        REQUIRE(arr[2] == 3);
+
+        arr.insert(1, 10);
+        REQUIRE(arr == GapArray<int>{1, 10, 2, 3});
+        REQUIRE(arr.gap_position() == 2);
+        arr.insert(2, 11);
+        REQUIRE(arr == GapArray<int>{1, 10, 11, 2, 3});
+
+        arr.erase(0);
+        REQUIRE(arr == GapArray<int>{10, 11, 2, 3});
+        arr.push_back(4);
+        arr.pop_back();
+        arr.pop_back();
+        REQUIRE(arr == GapArray<int>{10, 11, 2});
+
+        REQUIRE_THROWS_AS(arr.at(3), std::out_of_range);
+        REQUIRE_THROWS_AS(arr.insert(4, 0), std::out_of_range);
+        REQUIRE_THROWS_AS(arr.erase(3), std::out_of_range);
+        REQUIRE_THROWS_AS(arr.move_gap(4), std::out_of_range);
+        REQUIRE_THROWS_AS(GapArray<int>(-1), std::invalid_argument);
+
+        arr.clear();
+        REQUIRE(arr.empty());
+        REQUIRE_THROWS_AS(arr.pop_back(), std::out_of_range);
+    }
+
+    TEST_CASE("Правки у курсора не двигают остальные элементы") {
+        GapArray<int> arr(1000, 7);
+        arr.move_gap(500);
+        int64_t capacity_before = arr.Capacity();
+        arr.reserve(capacity_before + 100);
+        REQUIRE(arr.gap_position() == 500);
+        for (int i = 0; i < 100; ++i) {
+            arr.insert(500 + i, i);
+            REQUIRE(arr.gap_position() == 501 + i);
+        }
+        REQUIRE(arr.Capacity() == capacity_before + 100);
+        REQUIRE(arr.Size() == 1100);
+        REQUIRE(arr[599] == 99);
+        REQUIRE(arr[600] == 7);
+    }
+
+    TEST_CASE("Совпадает с std::vector на случайных правках") {
+        std::mt19937 gen(5);
+        GapArray<std::string> arr;
+        std::vector<std::string> expected;
+        int64_t cursor = 0;
+        for (int step = 0; step < 5000; ++step) {
+            int64_t size = static_cast<int64_t>(expected.size());
+            if (gen() % 10 == 0) {
+                cursor = size > 0 ? static_cast<int64_t>(gen() % (size + 1)) : 0;
+            }
+            cursor = std::min(cursor, size);
+            if (size > 0 && cursor > 0 && gen() % 3 == 0) {
+                --cursor;
+                arr.erase(cursor);
+                expected.erase(expected.begin() + cursor);
+            } else {
+                std::string value = std::to_string(step);
+                arr.insert(cursor, value);
+                expected.insert(expected.begin() + cursor, value);
+                ++cursor;
+            }
+        }
+        REQUIRE(arr.Size() == static_cast<int64_t>(expected.size()));
+        REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin()));
+
+        GapArray<std::string> copy = arr;
+        REQUIRE(copy == arr);
+        GapArray<std::string> moved = std::move(copy);
+        REQUIRE(moved == arr);
+    }
+
+    TEST_CASE("resize и assign") {
+        GapArray<int> arr{1, 2, 3, 4};
+        arr.move_gap(1);
+        arr.resize(6);
+        REQUIRE(arr == GapArray<int>{1, 2, 3, 4, 0, 0});
+        arr.resize(2);
+        REQUIRE(arr == GapArray<int>{1, 2});
+        arr.assign(3, 9);
+        REQUIRE(arr == GapArray<int>{9, 9, 9});
+
+        // Вставка элемента самого массива
+        arr.insert(0, arr[2]);
+        REQUIRE(arr.Size() == 4);
+        REQUIRE(arr[0] == 9);
+    }
+}
@@ -0,0 +1,84 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "mapped_dynamic_array.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace {
+
+std::string temp_path(const char* name) {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+} // namespace
+
+TEST_SUITE("Массив в отображённом файле") {
+    TEST_CASE("Запись и повторное открытие") {
+        auto path = temp_path("mapped_dynamic_array_roundtrip.bin");
+        {
+            MappedDynamicArray arr(path);
+            REQUIRE(arr.empty());
+            for (int i = 0; i < 5000; ++i)
+                arr.push_back(i * 3);
+            REQUIRE(arr.Size() == 5000);
+            REQUIRE(arr.Capacity() >= 5000);
+            arr[10] = -1;
+            arr.flush();
+        }
+        REQUIRE(std::filesystem::file_size(path) == 64 + 5000 * sizeof(int));
+
+        {
+            MappedDynamicArray arr(path, MappedDynamicArray::Mode::ReadOnly);
+            const MappedDynamicArray& carr = arr;
+            REQUIRE(arr.read_only());
+            REQUIRE(arr.Size() == 5000);
+            REQUIRE(carr[10] == -1);
+            REQUIRE(carr.at(4999) == 4999 * 3);
+            REQUIRE(carr.end() - carr.begin() == 5000);
+            REQUIRE_THROWS_AS(arr.push_back(1), std::logic_error);
+            REQUIRE_THROWS_AS(carr.at(5000), std::out_of_range);
+            REQUIRE_THROWS_AS(arr[10], std::logic_error);
+            REQUIRE_THROWS_AS(arr.at(10), std::logic_error);
+            REQUIRE_THROWS_AS(arr.begin(), std::logic_error);
+            REQUIRE_THROWS_AS(arr.end(), std::logic_error);
+            arr.advise(MappedDynamicArray::Access::Sequential);
+            arr.advise(MappedDynamicArray::Access::WillNeed, 100, 200);
+        }
+
+        {
+            MappedDynamicArray arr(path);
+            arr.pop_back();
+            arr.resize(5002);
+            REQUIRE(arr[4999] == 0);
+            REQUIRE(arr[5001] == 0);
+
+            auto moved = std::move(arr);
+            REQUIRE(moved.Size() == 5002);
+            REQUIRE(arr.Size() == 0);
+        }
+
+        {
+            MappedDynamicArray arr(path, MappedDynamicArray::Mode::Create);
+            REQUIRE(arr.empty());
+            arr.resize(3);
+            REQUIRE(arr[2] == 0);
+        }
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Ошибки открытия") {
+        auto path = temp_path("mapped_dynamic_array_bad.bin");
+        REQUIRE_THROWS_AS(MappedDynamicArray(path, MappedDynamicArray::Mode::ReadOnly), std::system_error);
+
+        {
+            std::ofstream out(path);
+            out << "definitely not a mapped array file, but long enough for a header......";
+        }
+        REQUIRE_THROWS_AS(MappedDynamicArray{path}, std::runtime_error);
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,147 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "monotonic_arena.hpp"
+#include "dynamic_array.hpp"
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+TEST_SUITE("Арена запроса") {
+    TEST_CASE("Выделение сдвигом и выравнивание") {
+        MonotonicArena arena(1024);
+        REQUIRE(arena.block_count() == 0);
+        void* a = arena.allocate(3, 1);
+        void* b = arena.allocate(8, 8);
+        void* c = arena.allocate(64, 64);
+        REQUIRE(reinterpret_cast<uintptr_t>(b) % 8 == 0);
+        REQUIRE(reinterpret_cast<uintptr_t>(c) % 64 == 0);
+        REQUIRE(static_cast<char*>(b) > static_cast<char*>(a));
+        REQUIRE(arena.block_count() == 1);
+        REQUIRE(arena.bytes_used() == 75);
+
+        // Запрос больше блока получает собственный блок
+        REQUIRE(arena.allocate(10000, 16) != nullptr);
+        REQUIRE(arena.block_count() == 2);
+        REQUIRE(arena.bytes_reserved() >= 10000);
+    }
+
+    TEST_CASE("reset оставляет самый большой блок") {
+        MonotonicArena arena(1024);
+        for (int i = 0; i < 100; ++i) {
+            REQUIRE(arena.allocate(500, 8) != nullptr);
+        }
+        int64_t blocks = arena.block_count();
+        REQUIRE(blocks > 1);
+
+        arena.reset();
+        REQUIRE(arena.block_count() == 1);
+        REQUIRE(arena.bytes_used() == 0);
+        size_t kept = arena.bytes_reserved();
+
+        // Повторный запрос того же объёма укладывается в оставленный блок
+        REQUIRE(arena.allocate(kept / 2, 8) != nullptr);
+        REQUIRE(arena.block_count() == 1);
+        REQUIRE_THROWS_AS(MonotonicArena(1024, nullptr), std::invalid_argument);
+    }
+
+    TEST_CASE("DynamicArray в арене") {
+        MonotonicArena arena;
+        {
+            DynamicArray arr(0, 0, &arena);
+            REQUIRE(arr.memory_resource() == &arena);
+            for (int i = 0; i < 1000; ++i) {
+                arr.push_back(i);
+            }
+            REQUIRE(arr.Size() == 1000);
+            REQUIRE(arr[999] == 999);
+            REQUIRE(arena.bytes_used() >= 1000 * sizeof(int));
+
+            arr.insert(0, -1);
+            arr.shrink_to_fit();
+            REQUIRE(arr[0] == -1);
+            REQUIRE(arr[1000] == 999);
+
+            // Копия по умолчанию уходит из арены, копия с ресурсом — остаётся
+            DynamicArray heap_copy(arr);
+            REQUIRE(heap_copy.memory_resource() == nullptr);
+            REQUIRE(heap_copy == arr);
+            DynamicArray arena_copy(arr, &arena);
+            REQUIRE(arena_copy.memory_resource() == &arena);
+            REQUIRE(arena_copy == arr);
+
+            // Присваивание сохраняет ресурс получателя
+            DynamicArray filled(5, 7, &arena);
+            filled = heap_copy;
+            REQUIRE(filled.memory_resource() == &arena);
+            REQUIRE(filled == arr);
+
+            // Перемещение забирает буфер вместе с ресурсом
+            DynamicArray moved(std::move(arena_copy));
+            REQUIRE(moved.memory_resource() == &arena);
+            heap_copy.swap(moved);
+            REQUIRE(heap_copy.memory_resource() == &arena);
+            REQUIRE(moved.memory_resource() == nullptr);
+        }
+        arena.reset();
+        REQUIRE(arena.bytes_used() == 0);
+        REQUIRE_THROWS_AS(DynamicArray(-1, 0, &arena), std::invalid_argument);
+    }
+
+    TEST_CASE("adopt у массива с ресурсом") {
+        MonotonicArena arena;
+        DynamicArray arr(0, 0, &arena);
+        for (int i = 0; i < 10; ++i) {
+            arr.push_back(i);
+        }
+        int64_t cap = arr.Capacity();
+
+        // Свой буфер: меняется только размер, память по-прежнему из арены
+        arr.adopt(arr.begin(), 3, cap);
+        REQUIRE(arr.memory_resource() == &arena);
+        REQUIRE(arr == DynamicArray{0, 1, 2});
+        for (int i = 0; i < 100; ++i) {
+            arr.push_back(i);
+        }
+        REQUIRE(arr.memory_resource() == &arena);
+        REQUIRE(arr[102] == 99);
+        REQUIRE_THROWS_AS(arr.adopt(arr.begin(), 3, arr.Capacity() + 1), std::invalid_argument);
+
+        // Чужой буфер массиву с ресурсом не передать
+        int* buffer = DynamicArray::allocate(4);
+        REQUIRE_THROWS_AS(arr.adopt(buffer, 0, 4), std::logic_error);
+        REQUIRE(arr.Size() == 103);
+        DynamicArray::deallocate(buffer, 4);
+
+        // Свой буфер тоже не отдать: он принадлежит арене
+        REQUIRE_THROWS_AS(arr.release(), std::logic_error);
+        REQUIRE(arr.Size() == 103);
+        REQUIRE(arr.memory_resource() == &arena);
+    }
+
+    TEST_CASE("Ресурс видит все выделения массива") {
+        struct Counting : std::pmr::memory_resource {
+            int64_t live = 0;
+            void* do_allocate(size_t bytes, size_t align) override {
+                ++live;
+                return std::pmr::new_delete_resource()->allocate(bytes, align);
+            }
+            void do_deallocate(void* p, size_t bytes, size_t align) override {
+                --live;
+                std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+            }
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                return this == &other;
+            }
+        } counting;
+        {
+            DynamicArray arr(10, 1, &counting);
+            for (int i = 0; i < 100; ++i) {
+                arr.push_back(i);
+            }
+            arr.resize(3);
+            arr.shrink_to_fit();
+            REQUIRE(counting.live == 1);
+        }
+        REQUIRE(counting.live == 0);
+    }
+}
@@ -0,0 +1,114 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "packed_int_array.hpp"
+#include "dynamic_array_simd.hpp"
+#include <climits>
+#include <random>
+
+namespace {
+
+DynamicArray random_values(int64_t n, int bits, unsigned seed) {
+    std::mt19937 gen(seed);
+    DynamicArray arr(n);
+    for (int64_t i = 0; i < n; ++i) {
+        arr[i] = bits == 32 ? static_cast<int>(gen()) : static_cast<int>(gen() & ((1u << bits) - 1)) - 1000;
+    }
+    return arr;
+}
+
+void require_same(const PackedIntArray& packed, const DynamicArray& arr) {
+    REQUIRE(packed.Size() == arr.Size());
+    REQUIRE(packed.to_array() == arr);
+    for (int64_t i = 0; i < arr.Size(); i += 7) {
+        REQUIRE(packed[i] == arr[i]);
+    }
+    REQUIRE(packed.sum() == simd::sum(arr));
+}
+
+} // namespace
+
+TEST_SUITE("Сжатый массив") {
+    TEST_CASE("Восстановление значений любой ширины") {
+        for (int bits : {1, 3, 8, 13, 17, 31, 32}) {
+            DynamicArray arr = random_values(1000, bits, static_cast<unsigned>(bits));
+            require_same(PackedIntArray(arr), arr);
+        }
+        DynamicArray extremes{INT_MIN, INT_MAX, 0, -1, INT_MAX, INT_MIN};
+        DynamicArray repeated;
+        for (int i = 0; i < 50; ++i) {
+            repeated.append(extremes.begin(), extremes.end());
+        }
+        require_same(PackedIntArray(repeated), repeated);
+    }
+
+    TEST_CASE("Выбор кодирования") {
+        DynamicArray timestamps;
+        int64_t t = 1700000000;
+        std::mt19937 gen(7);
+        for (int i = 0; i < 1024; ++i) {
+            t += gen() % 16;
+            timestamps.push_back(static_cast<int>(t));
+        }
+        PackedIntArray packed(timestamps);
+        REQUIRE(packed.block_count() == 8);
+        for (int64_t b = 0; b < packed.block_count(); ++b) {
+            REQUIRE(packed.block_encoding(b) == PackedIntArray::Encoding::Delta);
+            REQUIRE(packed.block_bits(b) <= 4);
+        }
+        require_same(packed, timestamps);
+        REQUIRE(packed.memory_bytes() * 5 < timestamps.Size() * static_cast<int64_t>(sizeof(int)));
+
+        DynamicArray constant(300, 42);
+        PackedIntArray flat(constant);
+        REQUIRE(flat.block_bits(0) == 0);
+        REQUIRE(flat.block_bits(2) == 32);  // неполный хвост не сжат
+        require_same(flat, constant);
+
+        DynamicArray small = random_values(256, 5, 3);
+        PackedIntArray ids(small);
+        REQUIRE(ids.block_encoding(0) == PackedIntArray::Encoding::FrameOfReference);
+        REQUIRE(ids.block_bits(0) <= 5);
+    }
+
+    TEST_CASE("Скалярная и векторная распаковка совпадают") {
+        DynamicArray arr = random_values(4096, 11, 5);
+        PackedIntArray packed(arr);
+        simd::set_level(simd::Level::Scalar);
+        DynamicArray scalar = packed.to_array();
+        simd::set_level(simd::detected_level());
+        DynamicArray vector = packed.to_array();
+        REQUIRE(scalar == arr);
+        REQUIRE(vector == arr);
+    }
+
+    TEST_CASE("push_back, доступ и сравнение") {
+        PackedIntArray packed;
+        DynamicArray plain;
+        REQUIRE(packed.empty());
+        for (int i = 0; i < 500; ++i) {
+            packed.push_back(i * i);
+            plain.push_back(i * i);
+        }
+        require_same(packed, plain);
+        REQUIRE(packed.block_count() == 4);
+        REQUIRE_THROWS_AS(packed.at(500), std::out_of_range);
+        REQUIRE_THROWS_AS(packed.decode_block(4, nullptr), std::out_of_range);
+        REQUIRE_THROWS_AS(PackedIntArray(plain.begin(), -1), std::invalid_argument);
+
+        PackedIntArray same(plain);
+        REQUIRE(packed == same);
+        same.push_back(1);
+        REQUIRE(packed != same);
+
+        int64_t seen = 0;
+        packed.for_each_block([&](const int* values, int64_t count) {
+            REQUIRE(values[0] == plain[seen]);
+            seen += count;
+        });
+        REQUIRE(seen == 500);
+
+        packed.clear();
+        REQUIRE(packed.empty());
+        REQUIRE(packed == PackedIntArray{});
+    }
+}
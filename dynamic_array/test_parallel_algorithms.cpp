@@ -0,0 +1,141 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "parallel_algorithms.hpp"
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+
+namespace {
+
+DynamicArray make_random(int64_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    DynamicArray arr(n);
+    for (int64_t i = 0; i < n; ++i)
+        arr[i] = static_cast<int>(gen());
+    return arr;
+}
+
+} // namespace
+
+TEST_SUITE("Параллельные алгоритмы") {
+    TEST_CASE("Пул потоков") {
+        parallel::ThreadPool pool(4);
+        REQUIRE(pool.size() == 4);
+
+        std::atomic<int64_t> total{0};
+        pool.parallel_for(1000000, 1000, [&](int64_t first, int64_t last) {
+            int64_t local = 0;
+            for (int64_t i = first; i < last; ++i)
+                local += i;
+            total += local;
+        });
+        REQUIRE(total == int64_t(1000000) * 999999 / 2);
+
+        // Вложенный parallel_for внутри задачи пула
+        std::atomic<int> calls{0};
+        pool.parallel_for(8, 1, [&](int64_t, int64_t) {
+            pool.parallel_for(4, 1, [&](int64_t first, int64_t last) {
+                calls += static_cast<int>(last - first);
+            });
+        });
+        REQUIRE(calls == 32);
+
+        REQUIRE_THROWS_AS(pool.parallel_for(100, 1, [](int64_t first, int64_t) {
+            if (first == 0)
+                throw std::runtime_error("task failed");
+        }), std::runtime_error);
+    }
+
+    TEST_CASE("Поразрядная сортировка") {
+        parallel::ThreadPool pool(4);
+        for (int64_t n : {0, 1, 2, 1000, 300000}) {
+            auto arr = make_random(n, 42);
+            arr.push_back(-1);
+            arr.push_back(0);
+            arr.push_back(2147483647);
+            arr.push_back(-2147483647 - 1);
+            auto expected = arr;
+            std::sort(expected.begin(), expected.end());
+
+            parallel::sort(arr, pool);
+            REQUIRE(arr == expected);
+        }
+
+        DynamicArray same(100000, 7);
+        parallel::sort(same, pool);
+        REQUIRE(same == DynamicArray(100000, 7));
+    }
+
+    TEST_CASE("Сортировка слиянием") {
+        parallel::ThreadPool pool(3);
+        {
+            auto arr = make_random(250000, 7);
+            auto expected = arr;
+            std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+            parallel::sort(arr, std::greater<int>(), pool);
+            REQUIRE(arr == expected);
+        }
+
+        {
+            // Устойчивость: порядок равных ключей сохраняется
+            std::vector<std::pair<int, int>> items(200000);
+            for (int i = 0; i < static_cast<int>(items.size()); ++i)
+                items[i] = {i % 17, i};
+            auto by_key = [](const auto& a, const auto& b) { return a.first < b.first; };
+            auto expected = items;
+            std::stable_sort(expected.begin(), expected.end(), by_key);
+
+            parallel::merge_sort(items.data(), items.data() + items.size(), by_key, pool);
+            REQUIRE(items == expected);
+        }
+
+        {
+            std::vector<std::string> words = {"pear", "apple", "fig", "kiwi"};
+            parallel::merge_sort(words.data(), words.data() + words.size());
+            REQUIRE(words == std::vector<std::string>{"apple", "fig", "kiwi", "pear"});
+        }
+
+        {
+            // Без конструктора по умолчанию и без копирования
+            struct Item {
+                std::unique_ptr<int> key;
+                explicit Item(int k) : key(std::make_unique<int>(k)) {}
+            };
+            parallel::ThreadPool wide(8);
+            std::vector<Item> items;
+            for (int i = 0; i < 300000; ++i)
+                items.emplace_back(static_cast<int>(int64_t(i) * 7919 % 300000));
+            parallel::merge_sort(items.data(), items.data() + items.size(),
+                                 [](const Item& a, const Item& b) { return *a.key < *b.key; }, wide);
+            for (int i = 0; i < 300000; ++i)
+                REQUIRE(*items[i].key == i);
+        }
+    }
+
+    TEST_CASE("transform, for_each и inclusive_scan") {
+        parallel::ThreadPool pool(4);
+        auto arr = make_random(100003, 3);
+
+        DynamicArray doubled;
+        parallel::transform(arr, doubled, [](int v) { return v / 2; }, pool);
+        REQUIRE(doubled.Size() == arr.Size());
+        for (int64_t i = 0; i < arr.Size(); i += 997)
+            REQUIRE(doubled[i] == arr[i] / 2);
+
+        parallel::for_each(arr, [](int& v) { v = v & 0xff; }, pool);
+        for (int64_t i = 0; i < arr.Size(); i += 997)
+            REQUIRE((arr[i] >= 0 && arr[i] < 256));
+
+        auto expected = arr;
+        std::partial_sum(expected.begin(), expected.end(), expected.begin());
+        parallel::inclusive_scan(arr, pool);
+        REQUIRE(arr == expected);
+
+        std::vector<int64_t> wide(70000, 1);
+        parallel::inclusive_scan(wide.data(), int64_t(wide.size()), wide.data(), std::plus<int64_t>(), pool);
+        REQUIRE(wide.back() == 70000);
+    }
+}
@@ -0,0 +1,136 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "persistent_vector.hpp"
+#include <string>
+#include <vector>
+
+TEST_SUITE("Персистентный вектор") {
+    TEST_CASE("Базовые операции") {
+        PersistentVector<int> vec;
+        REQUIRE(vec.empty());
+        REQUIRE_THROWS_AS(vec.pop_back(), std::out_of_range);
+        REQUIRE_THROWS_AS(PersistentVector<int>(-1), std::invalid_argument);
+
+        PersistentVector<int> list{1, 2, 3};
+        REQUIRE(list.Size() == 3);
+        REQUIRE(list[1] == 2);
+        REQUIRE(list.at(2) == 3);
+        REQUIRE_THROWS_AS(list.at(3), std::out_of_range);
+        REQUIRE_THROWS_AS(list.set(-1, 0), std::out_of_range);
+
+        PersistentVector<std::string> filled(40, "x");
+        REQUIRE(filled.Size() == 40);
+        REQUIRE(filled[39] == "x");
+    }
+
+    TEST_CASE("Старые версии не меняются") {
+        const int64_t n = 40000;  // три уровня дерева
+        PersistentVector<int> vec;
+        std::vector<PersistentVector<int>> versions;
+        for (int64_t i = 0; i < n; ++i) {
+            if (i % 1000 == 0) {
+                versions.push_back(vec);
+            }
+            vec.push_back(static_cast<int>(i));
+        }
+        REQUIRE(vec.Size() == n);
+        for (int64_t i = 0; i < n; ++i) {
+            REQUIRE(vec[i] == i);
+        }
+        for (size_t v = 0; v < versions.size(); ++v) {
+            REQUIRE(versions[v].Size() == static_cast<int64_t>(v) * 1000);
+        }
+
+        PersistentVector<int> before = vec;
+        vec.set(5, -5);
+        vec.set(n - 1, -1);
+        vec.set(33000, -33);
+        REQUIRE(vec[5] == -5);
+        REQUIRE(vec[n - 1] == -1);
+        REQUIRE(vec[33000] == -33);
+        REQUIRE(before[5] == 5);
+        REQUIRE(before[n - 1] == n - 1);
+        REQUIRE(before[33000] == 33000);
+        REQUIRE(vec != before);
+    }
+
+    TEST_CASE("pop_back сворачивает дерево") {
+        const int64_t n = 33 * 32 + 5;
+        PersistentVector<int> vec;
+        for (int64_t i = 0; i < n; ++i) {
+            vec.push_back(static_cast<int>(i));
+        }
+        PersistentVector<int> full = vec;
+        for (int64_t size = n; size > 0; --size) {
+            REQUIRE(vec.Size() == size);
+            REQUIRE(vec[size - 1] == size - 1);
+            REQUIRE(vec[0] == 0);
+            vec.pop_back();
+        }
+        REQUIRE(vec.empty());
+
+        vec.push_back(7);
+        REQUIRE(vec.Size() == 1);
+        REQUIRE(vec[0] == 7);
+        REQUIRE(full.Size() == n);
+        REQUIRE(full[n - 1] == n - 1);
+
+        // Запись в хвост после pop_back не портит версию, где элемент ещё был
+        PersistentVector<int> shorter = full;
+        shorter.pop_back();
+        shorter.push_back(-1);
+        REQUIRE(full[n - 1] == n - 1);
+        REQUIRE(shorter[n - 1] == -1);
+    }
+
+    TEST_CASE("Транзиентная сборка") {
+        PersistentVector<int> base{1, 2, 3};
+        auto builder = base.transient();
+        for (int i = 4; i <= 2000; ++i) {
+            builder.push_back(i);
+        }
+        builder.set(0, 100);
+        builder.pop_back();
+        REQUIRE(builder.Size() == 1999);
+
+        PersistentVector<int> built = builder.persistent();
+        REQUIRE_THROWS_AS(builder.push_back(0), std::logic_error);
+        REQUIRE(base == PersistentVector<int>{1, 2, 3});
+        REQUIRE(built.Size() == 1999);
+        REQUIRE(built[0] == 100);
+        REQUIRE(built[1998] == 1999);
+
+        // Узлы, отданные persistent(), больше не изменяются на месте
+        auto next = built.transient();
+        next.set(1000, -1);
+        PersistentVector<int> changed = next.persistent();
+        REQUIRE(built[1000] == 1001);
+        REQUIRE(changed[1000] == -1);
+    }
+
+    TEST_CASE("Итераторы и сравнение") {
+        PersistentVector<int> vec;
+        for (int i = 0; i < 100; ++i) {
+            vec.push_back(i);
+        }
+        int expected = 0;
+        for (int value : vec) {
+            REQUIRE(value == expected++);
+        }
+        REQUIRE(vec.end() - vec.begin() == 100);
+
+        PersistentVector<int> other;
+        for (int i = 0; i < 100; ++i) {
+            other.push_back(i);
+        }
+        REQUIRE(vec == other);
+        other.set(50, 0);
+        REQUIRE(vec != other);
+
+        vec.swap(other);
+        REQUIRE(vec[50] == 0);
+        REQUIRE(other[50] == 50);
+        vec.clear();
+        REQUIRE(vec.empty());
+    }
+}
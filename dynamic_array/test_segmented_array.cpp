@@ -0,0 +1,139 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "segmented_array.hpp"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace {
+// Считает живые объекты и бросает из присваивания после заданного числа копий
+struct Fragile {
+    static int live;
+    static int copies_left;
+
+    Fragile() { ++live; }
+    Fragile(const Fragile&) { ++live; }
+    ~Fragile() { --live; }
+
+    Fragile& operator=(const Fragile&) {
+        if (copies_left-- == 0) {
+            throw std::runtime_error("copy failed");
+        }
+        return *this;
+    }
+};
+
+int Fragile::live = 0;
+int Fragile::copies_left = 0;
+} // namespace
+
+TEST_SUITE("Блочный массив") {
+    TEST_CASE("Конструкторы и доступ") {
+        {
+            auto arr = SegmentedArray<int, 2>();
+            REQUIRE(arr.Size() == 0);
+            REQUIRE(arr.Capacity() == 0);
+            REQUIRE(arr.empty());
+        }
+
+        {
+            auto arr = SegmentedArray<int, 2>(10, 42);
+            REQUIRE(arr.Size() == 10);
+            REQUIRE(arr.Capacity() == 12);
+            for (int i = 0; i < 10; ++i)
+                REQUIRE(arr[i] == 42);
+            REQUIRE_THROWS_AS(arr.at(10), std::out_of_range);
+            REQUIRE_THROWS_AS(arr.at(-1), std::out_of_range);
+        }
+
+        {
+            auto arr = SegmentedArray<int, 2>{1, 2, 3, 4, 5, 6};
+            auto copy = arr;
+            REQUIRE(copy == arr);
+            copy[5] = 0;
+            REQUIRE(copy != arr);
+
+            auto moved = std::move(copy);
+            REQUIRE(moved.Size() == 6);
+            REQUIRE(copy.empty());
+        }
+    }
+
+    TEST_CASE("Стабильные ссылки при росте") {
+        SegmentedArray<int, 3> arr;
+        arr.push_back(7);
+        int* first = &arr[0];
+        int& ref = arr[0];
+
+        for (int i = 1; i < 1000; ++i)
+            arr.push_back(arr[i - 1] + 1);
+
+        REQUIRE(&arr[0] == first);
+        REQUIRE(ref == 7);
+        REQUIRE(arr[999] == 1006);
+        REQUIRE(arr.chunk_count() == 125);
+        REQUIRE(arr.chunk_size(124) == 8);
+    }
+
+    TEST_CASE("Конструкторы освобождают блоки, если копия элемента бросила") {
+        Fragile::copies_left = 10;
+        REQUIRE_THROWS_AS((SegmentedArray<Fragile, 2>(20)), std::runtime_error);
+        REQUIRE(Fragile::live == 0);
+
+        Fragile::copies_left = 5;
+        REQUIRE_THROWS_AS((SegmentedArray<Fragile, 2>{Fragile(), Fragile(), Fragile(), Fragile(),
+                                                      Fragile(), Fragile(), Fragile(), Fragile()}),
+                          std::runtime_error);
+        REQUIRE(Fragile::live == 0);
+
+        Fragile::copies_left = 12;
+        {
+            SegmentedArray<Fragile, 2> source(12);
+            Fragile::copies_left = 7;
+            REQUIRE_THROWS_AS((SegmentedArray<Fragile, 2>(source)), std::runtime_error);
+        }
+        REQUIRE(Fragile::live == 0);
+    }
+
+    TEST_CASE("Модификаторы") {
+        SegmentedArray<std::string, 1> arr{"b", "d"};
+        arr.insert(0, "a");
+        arr.insert(2, "c");
+        arr.insert(4, "e");
+        REQUIRE(arr == SegmentedArray<std::string, 1>{"a", "b", "c", "d", "e"});
+        REQUIRE_THROWS_AS(arr.insert(7, "x"), std::out_of_range);
+
+        arr.erase(1);
+        REQUIRE(arr == SegmentedArray<std::string, 1>{"a", "c", "d", "e"});
+        REQUIRE_THROWS_AS(arr.erase(4), std::out_of_range);
+
+        arr.resize(6);
+        REQUIRE(arr[5].empty());
+        arr.assign(3, "z");
+        REQUIRE(arr == SegmentedArray<std::string, 1>{"z", "z", "z"});
+
+        arr.pop_back();
+        arr.shrink_to_fit();
+        REQUIRE(arr.Capacity() == 2);
+        arr.clear();
+        REQUIRE(arr.empty());
+        REQUIRE_THROWS_AS(arr.pop_back(), std::out_of_range);
+    }
+
+    TEST_CASE("Итераторы") {
+        SegmentedArray<int, 2> arr;
+        for (int i = 0; i < 37; ++i)
+            arr.push_back(37 - i);
+
+        std::sort(arr.begin(), arr.end());
+        REQUIRE(std::is_sorted(arr.begin(), arr.end()));
+        REQUIRE(arr[0] == 1);
+
+        const auto& view = arr;
+        REQUIRE(std::accumulate(view.begin(), view.end(), 0) == 37 * 38 / 2);
+        SegmentedArray<int, 2>::const_iterator it = arr.begin();
+        REQUIRE(*(it + 36) == 37);
+        REQUIRE(view.end() - it == 37);
+    }
+}
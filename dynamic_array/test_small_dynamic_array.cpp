@@ -0,0 +1,115 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "small_dynamic_array.hpp"
+#include <string>
+
+TEST_SUITE("Массив со встроенным буфером") {
+    TEST_CASE("Конструкторы") {
+        {
+            auto arr = SmallDynamicArray<int, 4>();
+            REQUIRE(arr.Size() == 0);
+            REQUIRE(arr.Capacity() == 4);
+            REQUIRE(arr.is_inline());
+        }
+
+        {
+            auto arr = SmallDynamicArray<int, 4>(3, 7);
+            REQUIRE(arr.Size() == 3);
+            REQUIRE(arr.is_inline());
+            for (int i = 0; i < 3; ++i)
+                REQUIRE(arr[i] == 7);
+        }
+
+        {
+            auto arr = SmallDynamicArray<int, 4>{1, 2, 3, 4, 5, 6};
+            REQUIRE(arr.Size() == 6);
+            REQUIRE_FALSE(arr.is_inline());
+            for (int i = 0; i < 6; ++i)
+                REQUIRE(arr[i] == i + 1);
+
+            auto copy = SmallDynamicArray<int, 4>(arr);
+            REQUIRE(copy == arr);
+        }
+    }
+
+    TEST_CASE("Переход из встроенного буфера в кучу") {
+        SmallDynamicArray<int, 4> arr;
+        for (int i = 0; i < 4; ++i)
+            arr.push_back(i);
+        REQUIRE(arr.is_inline());
+        REQUIRE(arr.Capacity() == 4);
+
+        arr.push_back(4);
+        REQUIRE_FALSE(arr.is_inline());
+        REQUIRE(arr.Capacity() == 8);
+        REQUIRE(arr.Size() == 5);
+
+        arr.push_back(arr[0]);
+        REQUIRE(arr[5] == 0);
+
+        int total = 0;
+        for (auto it = arr.begin(); it != arr.end(); ++it)
+            total += *it;
+        REQUIRE(total == 10);
+    }
+
+    TEST_CASE("Модификаторы") {
+        SmallDynamicArray<int, 4> arr{10, 30, 40};
+
+        arr.insert(1, 20);
+        REQUIRE(arr == SmallDynamicArray<int, 4>{10, 20, 30, 40});
+        arr.insert(4, 50);
+        REQUIRE(arr == SmallDynamicArray<int, 4>{10, 20, 30, 40, 50});
+        REQUIRE_THROWS_AS(arr.insert(-1, 0), std::out_of_range);
+
+        arr.erase(0);
+        REQUIRE(arr == SmallDynamicArray<int, 4>{20, 30, 40, 50});
+        REQUIRE_THROWS_AS(arr.erase(4), std::out_of_range);
+
+        arr.resize(6);
+        REQUIRE(arr[4] == 0);
+        REQUIRE(arr[5] == 0);
+        REQUIRE_THROWS_AS(arr.resize(-1), std::invalid_argument);
+
+        arr.assign(2, 9);
+        REQUIRE(arr == SmallDynamicArray<int, 4>{9, 9});
+
+        arr.pop_back();
+        arr.pop_back();
+        REQUIRE(arr.empty());
+        REQUIRE_THROWS_AS(arr.pop_back(), std::out_of_range);
+        REQUIRE_THROWS_AS(arr.at(0), std::out_of_range);
+    }
+
+    TEST_CASE("Перемещение и обмен") {
+        {
+            SmallDynamicArray<std::string, 2> small{"a", "b"};
+            SmallDynamicArray<std::string, 2> big{"x", "y", "z"};
+            const std::string* big_data = big.begin();
+
+            small.swap(big);
+            REQUIRE(small.Size() == 3);
+            REQUIRE(small.begin() == big_data);
+            REQUIRE(small[2] == "z");
+            REQUIRE(big.Size() == 2);
+            REQUIRE(big.is_inline());
+            REQUIRE(big[1] == "b");
+        }
+
+        {
+            SmallDynamicArray<std::string, 2> src{"a", "b", "c"};
+            const std::string* heap = src.begin();
+
+            auto dst = std::move(src);
+            REQUIRE(dst.begin() == heap);
+            REQUIRE(src.empty());
+            REQUIRE(src.is_inline());
+
+            SmallDynamicArray<std::string, 2> inl{"q"};
+            dst = std::move(inl);
+            REQUIRE(dst.Size() == 1);
+            REQUIRE(dst.is_inline());
+            REQUIRE(dst[0] == "q");
+        }
+    }
+}
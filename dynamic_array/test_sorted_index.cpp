@@ -0,0 +1,66 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "sorted_index.hpp"
+#include <algorithm>
+#include <climits>
+#include <random>
+#include <vector>
+
+TEST_SUITE("Индекс Эйтцингера") {
+    TEST_CASE("lower_bound совпадает с std::lower_bound") {
+        std::mt19937 gen(3);
+        for (int64_t n : {1, 2, 3, 15, 16, 17, 100, 1000, 4097}) {
+            DynamicArray keys(n);
+            for (int64_t i = 0; i < n; ++i) {
+                keys[i] = static_cast<int>(gen() % 500) * 2;  // повторы и чётные ключи
+            }
+            SortedIndex index(keys);
+            REQUIRE(index.Size() == n);
+            std::sort(keys.begin(), keys.end());
+            for (int key = -3; key <= 1003; ++key) {
+                int64_t expected = std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+                REQUIRE(index.lower_bound(key) == expected);
+                REQUIRE(index.contains(key) == std::binary_search(keys.begin(), keys.end(), key));
+            }
+        }
+    }
+
+    TEST_CASE("Крайние значения и пустой индекс") {
+        SortedIndex empty;
+        REQUIRE(empty.empty());
+        REQUIRE(empty.lower_bound(0) == 0);
+        REQUIRE_FALSE(empty.contains(0));
+
+        SortedIndex extremes(DynamicArray{INT_MAX, INT_MIN, 0});
+        REQUIRE(extremes.lower_bound(INT_MIN) == 0);
+        REQUIRE(extremes.lower_bound(1) == 2);
+        REQUIRE(extremes.contains(INT_MAX));
+        REQUIRE(extremes.contains(INT_MIN));
+        REQUIRE_FALSE(extremes.contains(INT_MAX - 1));
+
+        int one = 1;
+        REQUIRE_THROWS_AS(SortedIndex(&one, -1), std::invalid_argument);
+    }
+
+    TEST_CASE("Пакетный поиск") {
+        std::mt19937 gen(11);
+        DynamicArray keys(10000);
+        for (int64_t i = 0; i < keys.Size(); ++i) {
+            keys[i] = static_cast<int>(gen() % 100000);
+        }
+        SortedIndex index(keys);
+
+        std::vector<int> queries(1001);
+        for (auto& q : queries) {
+            q = static_cast<int>(gen() % 110000) - 5000;
+        }
+        std::vector<int64_t> ranks(queries.size());
+        bool found[1001];
+        index.lower_bound(queries.data(), static_cast<int64_t>(queries.size()), ranks.data());
+        index.contains(queries.data(), static_cast<int64_t>(queries.size()), found);
+        for (size_t i = 0; i < queries.size(); ++i) {
+            REQUIRE(ranks[i] == index.lower_bound(queries[i]));
+            REQUIRE(found[i] == index.contains(queries[i]));
+        }
+    }
+}
@@ -0,0 +1,150 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace parallel {
+namespace {
+
+// Пул и номер очереди текущего рабочего потока (npos для внешних потоков)
+constexpr unsigned npos = ~0u;
+thread_local const ThreadPool* tls_pool = nullptr;
+thread_local unsigned tls_index = npos;
+
+} // namespace
+
+ThreadPool::ThreadPool(unsigned threads) {
+    threads = std::max(1u, threads);
+    for (unsigned i = 0; i < threads; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    workers_.reserve(threads);
+    for (unsigned i = 0; i < threads; ++i) {
+        workers_.emplace_back([this, i] { worker_loop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+unsigned ThreadPool::size() const {
+    return static_cast<unsigned>(queues_.size());
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    unsigned index = tls_pool == this ? tls_index : next_queue_++ % size();
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    ++queued_;
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+    }
+    wake_.notify_one();
+}
+
+bool ThreadPool::try_run_one(unsigned self) {
+    std::function<void()> task;
+    unsigned count = size();
+    if (self != npos) {
+        Queue& own = *queues_[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+        }
+    }
+    for (unsigned k = 1; !task && k <= count; ++k) {
+        unsigned victim = self == npos ? k - 1 : (self + k) % count;
+        if (victim == self) {
+            continue;
+        }
+        Queue& other = *queues_[victim];
+        std::lock_guard<std::mutex> lock(other.mutex);
+        if (!other.tasks.empty()) {
+            task = std::move(other.tasks.front());
+            other.tasks.pop_front();
+        }
+    }
+    if (!task) {
+        return false;
+    }
+    --queued_;
+    task();
+    return true;
+}
+
+void ThreadPool::worker_loop(unsigned index) {
+    tls_pool = this;
+    tls_index = index;
+    while (true) {
+        if (try_run_one(index)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [this] { return stop_ || queued_.load() > 0; });
+        if (stop_ && queued_.load() == 0) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::parallel_for(int64_t n, int64_t grain, const std::function<void(int64_t, int64_t)>& fn) {
+    if (n <= 0) {
+        return;
+    }
+    grain = std::max(int64_t(1), grain);
+    int64_t chunks = std::min((n + grain - 1) / grain, int64_t(size()) * 4);
+    if (chunks <= 1) {
+        fn(0, n);
+        return;
+    }
+    int64_t step = (n + chunks - 1) / chunks;
+
+    std::atomic<int64_t> remaining{chunks};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    for (int64_t c = 0; c < chunks; ++c) {
+        int64_t begin = c * step;
+        int64_t end = std::min(n, begin + step);
+        submit([&, begin, end] {
+            try {
+                if (begin < end) {
+                    fn(begin, end);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+            --remaining;
+        });
+    }
+
+    unsigned self = tls_pool == this ? tls_index : npos;
+    while (remaining.load() > 0) {
+        if (!try_run_one(self)) {
+            std::this_thread::yield();
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+ThreadPool& ThreadPool::global() {
+    static ThreadPool pool;
+    return pool;
+}
+
+} // namespace parallel
@@ -0,0 +1,61 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace parallel {
+
+// Пул потоков с перехватом задач: у каждого рабочего своя очередь, из
+// конца которой он берёт задачи, а простаивающие потоки забирают задачи
+// из начала чужих очередей.
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned threads = std::thread::hardware_concurrency());
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned size() const;
+
+    void submit(std::function<void()> task);
+
+    // Выполняет fn(begin, end) для блоков [0, n) размером не меньше grain
+    // и ждёт их завершения; вызывающий поток тоже берёт задачи.
+    void parallel_for(int64_t n, int64_t grain, const std::function<void(int64_t, int64_t)>& fn);
+
+    // Пул процесса с числом потоков hardware_concurrency()
+    static ThreadPool& global();
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void worker_loop(unsigned index);
+
+    // Берёт одну задачу (свою или чужую) и выполняет её
+    bool try_run_one(unsigned self);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<int64_t> queued_{0};
+    std::atomic<unsigned> next_queue_{0};
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+};
+
+} // namespace parallel
+
+#endif // THREAD_POOL_HPP
@@ -2,9 +2,21 @@
 
 #include <vector>
 #include <functional>
+#include <memory_resource>
+#include "alloc_tracking.hpp"
+#include <type_traits>
 #include <utility>
 #include <stdexcept>
 
+// Как таблица освобождает узлы при разрушении. WithResource — обещание
+// вызывающего, что ресурс освобождает память сам целиком (монотонная арена
+// с reset()): тогда узлы с тривиально разрушаемыми ключом и значением не
+// обходятся
+enum class NodeRelease {
+    PerNode,
+    WithResource
+};
+
 template<typename KeyType, typename ValueType>
 class HashTable {
 private:
@@ -16,18 +28,36 @@ private:
         Node(const KeyType& k, const ValueType& v) : key(k), value(v), next(nullptr) {}
     };
 
-    std::vector<Node*> table;
+    // Корзины и узлы выделяются из одного memory_resource
+    std::pmr::vector<Node*> table;
     std::hash<KeyType> hash_function;
     size_t size_;
+    NodeRelease release_ = NodeRelease::PerNode;
 
 public:
-    HashTable(size_t capacity = 16) : table(capacity, nullptr), size_(0) {}
+    // resource должен пережить таблицу; с аренной памятью весь запрос
+    // освобождается одним reset() арены
+    HashTable(size_t capacity = 16, std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+              NodeRelease release = NodeRelease::PerNode)
+        : table(capacity, nullptr, resource), size_(0), release_(release) {
+        track_buckets_allocated();
+    }
 
     ~HashTable() {
-        clear();
+        // Узлы в арене с тривиальными деструкторами не обходятся: их память
+        // вернёт reset() арены, а корзины освободит сам vector
+        if (!released_by_resource()) {
+            clear();
+        }
+        track_buckets_freed(table.capacity());
     }
 
-    HashTable(const HashTable& other) : table(other.table.size(), nullptr), hash_function(other.hash_function), size_(0) {
+    // Копия, как и у std::pmr-контейнеров, использует память по умолчанию и
+    // освобождает узлы по одному: её ресурс может быть другим
+    HashTable(const HashTable& other, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : table(other.table.size(), nullptr, resource), hash_function(other.hash_function), size_(0) {
+        track_buckets_allocated();
+        ALLOC_TRACK_COPY("HashTable", other.size_ * sizeof(Node));
         for (auto it = other.begin(); it != other.end(); ++it) {
             const auto& pair = *it;
             insert(pair.first, pair.second);
@@ -36,8 +66,14 @@ public:
 
     HashTable& operator=(const HashTable& other) {
         if (this != &other) {
+            ALLOC_TRACK_COPY("HashTable", other.size_ * sizeof(Node));
             clear();
+            size_t old_buckets = table.capacity();
             table.resize(other.table.size(), nullptr);
+            if (table.capacity() != old_buckets) {
+                track_buckets_freed(old_buckets);
+                track_buckets_allocated();
+            }
             size_ = 0;
             for (auto it = other.begin(); it != other.end(); ++it) {
                 const auto& pair = *it;
@@ -52,7 +88,7 @@ public:
             while (head) {
                 Node* temp = head;
                 head = head->next;
-                delete temp;
+                destroy_node(temp);
             }
         }
         std::fill(table.begin(), table.end(), nullptr);
@@ -71,7 +107,7 @@ public:
             current = current->next;
         }
         
-        Node* new_node = new Node(key, value);
+        Node* new_node = create_node(key, value);
         new_node->next = table[index];
         table[index] = new_node;
         size_++;
@@ -106,7 +142,7 @@ public:
             current = current->next;
         }
         
-        Node* new_node = new Node(key, ValueType());
+        Node* new_node = create_node(key, ValueType());
         new_node->next = table[index];
         table[index] = new_node;
         size_++;
@@ -134,10 +170,45 @@ public:
         return size_ == 0;
     }
 
+    std::pmr::memory_resource* memory_resource() const {
+        return table.get_allocator().resource();
+    }
+
 private:
+    Node* create_node(const KeyType& key, const ValueType& value) {
+        std::pmr::polymorphic_allocator<Node> alloc(memory_resource());
+        Node* node = alloc.allocate(1);
+        try {
+            alloc.construct(node, key, value);
+        } catch (...) {
+            alloc.deallocate(node, 1);
+            throw;
+        }
+        ALLOC_TRACK_ALLOC("HashTable", sizeof(Node));
+        return node;
+    }
+
+    void destroy_node(Node* node) {
+        std::pmr::polymorphic_allocator<Node> alloc(memory_resource());
+        node->~Node();
+        alloc.deallocate(node, 1);
+        ALLOC_TRACK_FREE("HashTable", sizeof(Node));
+    }
+
+    // С учётом выделений узлы освобождаются по одному, чтобы счётчики сошлись
+    bool released_by_resource() const {
+        return std::is_trivially_destructible<KeyType>::value &&
+               std::is_trivially_destructible<ValueType>::value &&
+               !alloc_tracking::enabled() &&
+               release_ == NodeRelease::WithResource;
+    }
+
+    // Узлы не перевыделяются: переезжает только массив корзин
     void rehash() {
+        ALLOC_TRACK_REALLOC("HashTable");
+        track_buckets_freed(table.capacity());
         size_t new_capacity = table.size() * 2;
-        std::vector<Node*> new_table(new_capacity, nullptr);
+        std::pmr::vector<Node*> new_table(new_capacity, nullptr, table.get_allocator());
         
         for (auto& head : table) {
             while (head) {
@@ -151,6 +222,19 @@ private:
         }
         
         table = std::move(new_table);
+        track_buckets_allocated();
+    }
+
+    void track_buckets_allocated() {
+        if (table.capacity() > 0) {
+            ALLOC_TRACK_ALLOC("HashTable", table.capacity() * sizeof(Node*));
+        }
+    }
+
+    void track_buckets_freed(size_t buckets) {
+        if (buckets > 0) {
+            ALLOC_TRACK_FREE("HashTable", buckets * sizeof(Node*));
+        }
     }
 
 public:
@@ -160,11 +244,11 @@ public:
     private:
         size_t index;
         Node* current;
-        std::vector<Node*>& table;
+        std::pmr::vector<Node*>& table;
 
     public:
-        Iterator(size_t i, Node* node, const std::vector<Node*>& tbl)
-            : index(i), current(node), table(const_cast<std::vector<Node*>&>(tbl)) {
+        Iterator(size_t i, Node* node, const std::pmr::vector<Node*>& tbl)
+            : index(i), current(node), table(const_cast<std::pmr::vector<Node*>&>(tbl)) {
             if (current == nullptr && index < table.size()) {
                 advance();
             }
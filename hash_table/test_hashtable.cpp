@@ -1,9 +1,11 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
 #include "hash_table.hpp"
+#include "monotonic_arena.hpp"
 #include <string>
 #include <sstream>
 #include <set>
+#include <memory_resource>
 
 TEST_CASE("Базовые операции хеш-таблицы") {
     HashTable<int, std::string> ht;
@@ -183,4 +185,47 @@ TEST_CASE("Сложные типы данных") {
     ht["один"].push_back(1111);
     CHECK(ht["один"].size() == 4);
     CHECK(ht["один"][3] == 1111);
-} 
\ No newline at end of file
+} 
+
+TEST_CASE("Хеш-таблица в арене запроса") {
+    MonotonicArena arena(1024);
+    {
+        HashTable<int, std::string> ht(4, &arena);
+        CHECK(ht.memory_resource() == &arena);
+        for (int i = 0; i < 100; ++i) {
+            ht.insert(i, std::to_string(i));
+        }
+        CHECK(ht.size() == 100);
+        CHECK(ht[42] == "42");
+        CHECK(arena.bytes_used() > 0);
+
+        // Копия по умолчанию не держит ссылку на арену
+        HashTable<int, std::string> copy(ht);
+        CHECK(copy.memory_resource() == std::pmr::get_default_resource());
+        CHECK(copy[99] == "99");
+
+        HashTable<int, std::string> in_arena(ht, &arena);
+        CHECK(in_arena.memory_resource() == &arena);
+        CHECK(in_arena.size() == 100);
+    }
+    arena.reset();
+    CHECK(arena.bytes_used() == 0);
+    CHECK(arena.block_count() == 1);
+}
+
+TEST_CASE("Таблица с тривиальными типами освобождается вместе с ареной") {
+    MonotonicArena arena;
+    for (int round = 0; round < 3; ++round) {
+        {
+            HashTable<int, double> ht(4, &arena, NodeRelease::WithResource);
+            for (int i = 0; i < 1000; ++i) {
+                ht.insert(i, i * 0.5);
+            }
+            CHECK(ht.size() == 1000);
+            CHECK(ht[500] == doctest::Approx(250.0));
+        }
+        CHECK(arena.bytes_used() > 0);
+        arena.reset();
+        CHECK(arena.bytes_used() == 0);
+    }
+}
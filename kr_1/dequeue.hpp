@@ -2,6 +2,7 @@
 #include <cstddef>
 #include <ostream>
 #include <utility>
+#include "alloc_tracking.hpp"
 
 class Dequeue {
 private:
@@ -17,14 +18,20 @@ public:
             capacity = 1;
         }
         data = new int[capacity];
+        ALLOC_TRACK_ALLOC("Dequeue", capacity * sizeof(int));
     }
 
     ~Dequeue() {
+        if (data) {
+            ALLOC_TRACK_FREE("Dequeue", capacity * sizeof(int));
+        }
         delete[] data;
     }
 
     Dequeue(const Dequeue& other) : capacity(other.capacity), front(other.front), back(other.back), count(other.count) {
         data = new int[capacity];
+        ALLOC_TRACK_ALLOC("Dequeue", capacity * sizeof(int));
+        ALLOC_TRACK_COPY("Dequeue", count * sizeof(int));
         size_t current_other = other.front;
         for (size_t i = 0; i < count; ++i) {
              data[(front + i) % capacity] = other.data[current_other];
@@ -54,6 +61,9 @@ public:
 
     Dequeue& operator=(Dequeue&& other) noexcept {
         if (this != &other) {
+            if (data) {
+                ALLOC_TRACK_FREE("Dequeue", capacity * sizeof(int));
+            }
             delete[] data;
 
             data = other.data;
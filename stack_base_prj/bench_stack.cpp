@@ -0,0 +1,122 @@
+// Цена виртуальной диспетчеризации стеков: одни и те же циклы push/top/pop
+// и сравнение стеков из 8 элементов над StackArrT и StackLstT напрямую
+// (StackBase, вызовы встраиваются) и через IStackBase (StackAdapter,
+// виртуальный вызов на каждую операцию).
+//
+//   bench_stack [N] [rounds]   (по умолчанию 10^6 элементов, 20 повторов)
+
+#include "stack_arr_t.hpp"
+#include "stack_lst_t.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+namespace {
+
+volatile long long sink;
+
+// Цикл в отдельной функции: компилятор не видит тип за IStackBase и не
+// может девиртуализировать вызовы
+template <typename Stack>
+__attribute__((noinline)) long long push_pop(Stack& stack, long long n) {
+    long long sum = 0;
+    for (long long i = 0; i < n; ++i) {
+        stack.push(static_cast<int>(i));
+    }
+    while (!stack.empty()) {
+        sum += stack.top();
+        stack.pop();
+    }
+    return sum;
+}
+
+// Стек неглубокий и всё время в кэше: видна стоимость самих вызовов
+template <typename Stack>
+__attribute__((noinline)) long long churn(Stack& stack, long long n) {
+    long long sum = 0;
+    for (long long i = 0; i < n; ++i) {
+        stack.push(static_cast<int>(i));
+        stack.push(static_cast<int>(i) + 1);
+        sum += stack.top() + stack.size();
+        stack.pop();
+        stack.pop();
+    }
+    return sum;
+}
+
+// Сравнение двух неглубоких равных стеков, как при поиске дубликатов
+template <typename Stack>
+__attribute__((noinline)) long long compare(Stack& a, Stack& b, long long n) {
+    long long equal = 0;
+    for (long long i = 0; i < n; ++i) {
+        equal += a == b;
+    }
+    return equal;
+}
+
+// Лучший из rounds прогонов, нс на одну операцию стека
+template <typename Stack, typename Loop>
+double measure(Stack& stack, Loop loop, long long n, long long ops_per_iter, int rounds) {
+    double best = 1e300;
+    for (int r = 0; r < rounds; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        sink = loop(stack, n);
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count() / static_cast<double>(n * ops_per_iter));
+    }
+    return best;
+}
+
+template <typename Stack>
+void run(const char* name, long long n, int rounds) {
+    Stack direct;
+    // Обёртка создаётся через фабрику, как в коде с выбором стека во время выполнения
+    std::unique_ptr<IStackBase<int>> erased(StackAdapter<Stack>().create_instance());
+
+    auto push_pop_direct = [](Stack& s, long long k) { return push_pop(s, k); };
+    auto push_pop_erased = [](IStackBase<int>& s, long long k) { return push_pop(s, k); };
+    auto churn_direct = [](Stack& s, long long k) { return churn(s, k); };
+    auto churn_erased = [](IStackBase<int>& s, long long k) { return churn(s, k); };
+
+    // push_pop: push, empty, top, pop на элемент; churn: 2 push, top, size, 2 pop
+    double pp_direct = measure(direct, push_pop_direct, n, 4, rounds);
+    double pp_erased = measure(*erased, push_pop_erased, n, 4, rounds);
+    double ch_direct = measure(direct, churn_direct, n, 6, rounds);
+    double ch_erased = measure(*erased, churn_erased, n, 6, rounds);
+
+    std::printf("%-10s %-9s %12.3f %12.3f %8.2f\n", name, "push_pop", pp_direct, pp_erased, pp_erased / pp_direct);
+    std::printf("%-10s %-9s %12.3f %12.3f %8.2f\n", name, "churn", ch_direct, ch_erased, ch_erased / ch_direct);
+
+    // ==: у обёрток проверка метки типа и виртуальный compare_impl
+    Stack lhs;
+    for (int i = 0; i < 8; ++i) {
+        lhs.push(i);
+    }
+    Stack rhs_direct(lhs);
+    std::unique_ptr<IStackBase<int>> lhs_erased(new StackAdapter<Stack>(lhs));
+    std::unique_ptr<IStackBase<int>> rhs_erased(lhs_erased->create_instance());
+    for (int i = 0; i < 8; ++i) {
+        rhs_erased->push(i);
+    }
+    auto cmp_direct = [&](Stack& s, long long k) { return compare(s, rhs_direct, k); };
+    auto cmp_erased = [&](IStackBase<int>& s, long long k) { return compare(s, *rhs_erased, k); };
+    double eq_direct = measure(lhs, cmp_direct, n, 1, rounds);
+    double eq_erased = measure(*lhs_erased, cmp_erased, n, 1, rounds);
+    std::printf("%-10s %-9s %12.3f %12.3f %8.2f\n", name, "==", eq_direct, eq_erased, eq_erased / eq_direct);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long long n = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    int rounds = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    std::printf("N = %lld, rounds = %d, ns per stack operation\n", n, rounds);
+    std::printf("%-10s %-9s %12s %12s %8s\n", "stack", "loop", "StackBase", "IStackBase", "ratio");
+    run<StackArrT<int>>("StackArrT", n, rounds);
+    run<StackLstT<int>>("StackLstT", n, rounds);
+    return 0;
+}
@@ -0,0 +1,176 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include "alloc_tracking.hpp"
+
+// Пул узлов одного типа: память берётся блоками (slab) растущего размера,
+// освобождённые узлы уходят в список свободных и выдаются снова без
+// обращения к malloc. Системе блоки возвращаются только целиком — в
+// release() и деструкторе. Первый блок — на 4 узла, чтобы маленькие
+// контейнеры не держали лишнего; дальше размер удваивается до 4096.
+// Пул не потокобезопасен.
+template <typename Node>
+class NodePool {
+public:
+    explicit NodePool(const char* owner = "NodePool") : owner_(owner) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    NodePool(NodePool&& other) noexcept : owner_(other.owner_) {
+        swap(other);
+    }
+
+    ~NodePool() {
+        release();
+    }
+
+    template <typename... Args>
+    Node* create(Args&&... args) {
+        Slot* slot = take();
+        try {
+            return ::new (static_cast<void*>(slot)) Node{std::forward<Args>(args)...};
+        } catch (...) {
+            put(slot);
+            throw;
+        }
+    }
+
+    void destroy(Node* node) noexcept {
+        node->~Node();
+        put(reinterpret_cast<Slot*>(node));
+    }
+
+    // Освобождает все блоки. Живых узлов в пуле остаться не должно:
+    // деструкторы узлов здесь не вызываются
+    void release() noexcept {
+        while (blocks_) {
+            Block* next = blocks_->next;
+            ALLOC_TRACK_FREE(owner_, blocks_->bytes);
+            ::operator delete(blocks_);
+            blocks_ = next;
+        }
+        free_ = nullptr;
+        bump_ = nullptr;
+        bump_end_ = nullptr;
+        next_slots_ = kFirstBlockSlots;
+    }
+
+    // Забирает блоки и свободные узлы другого пула: его живые узлы
+    // становятся узлами этого пула, другой пул остаётся пустым
+    void absorb(NodePool& other) noexcept {
+        if (&other == this) {
+            return;
+        }
+        while (other.bump_ != other.bump_end_) {
+            put(other.bump_++);
+        }
+        if (other.free_) {
+            Slot* tail = other.free_;
+            while (tail->next) {
+                tail = tail->next;
+            }
+            tail->next = free_;
+            free_ = other.free_;
+        }
+        if (other.blocks_) {
+            Block* tail = other.blocks_;
+            while (tail->next) {
+                tail = tail->next;
+            }
+            tail->next = blocks_;
+            blocks_ = other.blocks_;
+        }
+        next_slots_ = std::max(next_slots_, other.next_slots_);
+        other.free_ = nullptr;
+        other.blocks_ = nullptr;
+        other.release();
+    }
+
+    void swap(NodePool& other) noexcept {
+        std::swap(blocks_, other.blocks_);
+        std::swap(free_, other.free_);
+        std::swap(bump_, other.bump_);
+        std::swap(bump_end_, other.bump_end_);
+        std::swap(next_slots_, other.next_slots_);
+    }
+
+    // Счётчики не хранятся, чтобы не увеличивать пул внутри каждого
+    // контейнера: блоки просто обходятся
+    std::size_t block_count() const {
+        std::size_t count = 0;
+        for (const Block* block = blocks_; block; block = block->next) {
+            ++count;
+        }
+        return count;
+    }
+
+    // Узлов во всех блоках, занятых и свободных
+    std::size_t slot_count() const {
+        std::size_t count = 0;
+        for (const Block* block = blocks_; block; block = block->next) {
+            count += (block->bytes - kHeaderBytes) / sizeof(Slot);
+        }
+        return count;
+    }
+
+private:
+    union Slot {
+        Slot* next;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    struct Block {
+        Block* next;
+        std::size_t bytes;
+    };
+
+    static_assert(alignof(Slot) <= alignof(std::max_align_t), "Over-aligned nodes are not supported");
+
+    static constexpr std::size_t kFirstBlockSlots = 4;
+    static constexpr std::size_t kMaxBlockSlots = 4096;
+    static constexpr std::size_t kHeaderBytes = (sizeof(Block) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+
+    Slot* take() {
+        if (free_) {
+            Slot* slot = free_;
+            free_ = slot->next;
+            return slot;
+        }
+        if (bump_ == bump_end_) {
+            grow();
+        }
+        return bump_++;
+    }
+
+    void put(Slot* slot) noexcept {
+        slot->next = free_;
+        free_ = slot;
+    }
+
+    // Новый блок не размечается в список свободных: узлы из него выдаются подряд
+    void grow() {
+        std::size_t bytes = kHeaderBytes + next_slots_ * sizeof(Slot);
+        Block* block = static_cast<Block*>(::operator new(bytes));
+        ALLOC_TRACK_ALLOC(owner_, bytes);
+        block->next = blocks_;
+        block->bytes = bytes;
+        blocks_ = block;
+        bump_ = reinterpret_cast<Slot*>(reinterpret_cast<char*>(block) + kHeaderBytes);
+        bump_end_ = bump_ + next_slots_;
+        next_slots_ = std::min(next_slots_ * 2, kMaxBlockSlots);
+    }
+
+    const char* owner_;         //!< имя контейнера для alloc_tracking
+    Block* blocks_ = nullptr;
+    Slot* free_ = nullptr;      //!< список освобождённых узлов
+    Slot* bump_ = nullptr;      //!< ещё не выданная часть последнего блока
+    Slot* bump_end_ = nullptr;
+    std::size_t next_slots_ = kFirstBlockSlots;
+};
+
+#endif // NODE_POOL_HPP
@@ -7,13 +7,17 @@
 #include <algorithm>
 #include <ostream>
 #include "stack_base.hpp"
+#include "alloc_tracking.hpp"
 
 template <typename T>
-class StackArrT : public IStackBase<T> {
+class StackArrT : public StackBase<StackArrT<T>, T> {
 public:
     StackArrT() = default;
     
     ~StackArrT() {
+        if (data_) {
+            ALLOC_TRACK_FREE("StackArrT", size_ * sizeof(T));
+        }
         delete[] data_;
     }
     
@@ -21,6 +25,8 @@ public:
         : size_(other.size_)
         , i_top_(other.i_top_) {
         data_ = new T[size_];
+        ALLOC_TRACK_ALLOC("StackArrT", size_ * sizeof(T));
+        ALLOC_TRACK_COPY("StackArrT", (i_top_ + 1) * sizeof(T));
         for (std::ptrdiff_t i = 0; i <= i_top_; ++i) {
             data_[i] = other.data_[i];
         }
@@ -39,20 +45,26 @@ public:
         : size_(list.size())
         , i_top_(list.size() - 1) {
         data_ = new T[size_];
+        ALLOC_TRACK_ALLOC("StackArrT", size_ * sizeof(T));
         std::ptrdiff_t i = 0;
         for (const auto& item : list) {
             data_[i++] = item;
         }
     }
     
-    // Реализация абстрактных методов базового класса
-    void push_impl(const T& value) override {
+    // Операции, которые вызывает StackBase
+    void push_impl(const T& value) {
         if (i_top_ + 1 >= size_) {
             std::ptrdiff_t new_size = (size_ == 0) ? 1 : size_ * 2;
             T* new_data = new T[new_size];
+            ALLOC_TRACK_ALLOC("StackArrT", new_size * sizeof(T));
             for (std::ptrdiff_t i = 0; i <= i_top_; ++i) {
                 new_data[i] = data_[i];
             }
+            if (data_) {
+                ALLOC_TRACK_REALLOC("StackArrT");
+                ALLOC_TRACK_FREE("StackArrT", size_ * sizeof(T));
+            }
             delete[] data_;
             data_ = new_data;
             size_ = new_size;
@@ -60,47 +72,40 @@ public:
         data_[++i_top_] = value;
     }
     
-    void pop_impl() override {
+    void pop_impl() {
         --i_top_;
     }
     
-    T& top_impl() const override {
+    T& top_impl() const {
         return data_[i_top_];
     }
     
-    bool empty_impl() const override {
+    bool empty_impl() const {
         return i_top_ < 0;
     }
     
-    std::ptrdiff_t size_impl() const override {
+    std::ptrdiff_t size_impl() const {
         return i_top_ + 1;
     }
     
-    IStackBase<T>* create_instance() const override {
-        return new StackArrT<T>();
+    void swap_impl(StackArrT<T>& other) {
+        std::swap(size_, other.size_);
+        std::swap(i_top_, other.i_top_);
+        std::swap(data_, other.data_);
     }
     
-    void swap_impl(IStackBase<T>& other) override {
-        StackArrT<T>* other_arr = dynamic_cast<StackArrT<T>*>(&other);
-        if (other_arr) {
-            std::swap(size_, other_arr->size_);
-            std::swap(i_top_, other_arr->i_top_);
-            std::swap(data_, other_arr->data_);
-        }
-    }
-    
-    void merge_impl(IStackBase<T>& other) override {
-        StackArrT<T>* other_arr = dynamic_cast<StackArrT<T>*>(&other);
-        if (!other_arr) {
+    void merge_impl(StackArrT<T>& other) {
+        if (other.empty()) {
             return;
         }
         
-        if (other_arr->empty()) {
-            return;
-        }
-        
-        std::ptrdiff_t new_size = size_ + other_arr->size();
+        std::ptrdiff_t new_size = size_ + other.size();
         T* new_data = new T[new_size];
+        ALLOC_TRACK_ALLOC("StackArrT", new_size * sizeof(T));
+        if (data_) {
+            ALLOC_TRACK_REALLOC("StackArrT");
+            ALLOC_TRACK_FREE("StackArrT", size_ * sizeof(T));
+        }
         
         // Копируем элементы текущего стека
         for (std::ptrdiff_t i = 0; i <= i_top_; ++i) {
@@ -108,34 +113,29 @@ public:
         }
         
         // Копируем элементы другого стека
-        for (std::ptrdiff_t i = 0; i <= other_arr->i_top_; ++i) {
-            new_data[i_top_ + 1 + i] = other_arr->data_[i];
+        for (std::ptrdiff_t i = 0; i <= other.i_top_; ++i) {
+            new_data[i_top_ + 1 + i] = other.data_[i];
         }
         
         delete[] data_;
         data_ = new_data;
         size_ = new_size;
-        i_top_ = i_top_ + other_arr->size();
+        i_top_ = i_top_ + other.size();
         
         // Очищаем другой стек
-        other_arr->clear();
+        other.clear();
     }
     
-    bool compare_impl(const IStackBase<T>& rhs) const override {
-        const StackArrT<T>* rhs_arr = dynamic_cast<const StackArrT<T>*>(&rhs);
-        if (!rhs_arr) {
-            return false;
-        }
-        
+    bool compare_impl(const StackArrT<T>& rhs) const {
         for (std::ptrdiff_t i = 0; i <= i_top_; ++i) {
-            if (data_[i] != rhs_arr->data_[i]) {
+            if (data_[i] != rhs.data_[i]) {
                 return false;
             }
         }
         return true;
     }
     
-    void printToStream(std::ostream& os) const override {
+    void printToStream(std::ostream& os) const {
         os << "[";
         for (std::ptrdiff_t i = 0; i <= i_top_; ++i) {
             os << data_[i];
@@ -156,6 +156,9 @@ public:
     
     StackArrT<T>& operator=(StackArrT<T>&& other) {
         if (this != &other) {
+            if (data_) {
+                ALLOC_TRACK_FREE("StackArrT", size_ * sizeof(T));
+            }
             delete[] data_;
             size_ = other.size_;
             i_top_ = other.i_top_;
@@ -169,6 +172,9 @@ public:
     
 private:
     void clear() {
+        if (data_) {
+            ALLOC_TRACK_FREE("StackArrT", size_ * sizeof(T));
+        }
         delete[] data_;
         data_ = nullptr;
         size_ = 0;
@@ -6,13 +6,100 @@
 #include <ostream>
 #include <stdexcept>
 #include <algorithm>
+#include <utility>
 
+// Общая часть стеков без виртуальных вызовов (CRTP): Derived реализует
+// *_impl, а проверки и API живут здесь и встраиваются в место вызова.
+// swap, merge и сравнение принимают только стек того же типа.
+template <typename Derived, typename T>
+class StackBase {
+public:
+    using value_type = T;
+
+    void push(const T& value) {
+        derived().push_impl(value);
+    }
+
+    void pop() {
+        if (empty()) {
+            throw std::out_of_range("Stack is empty");
+        }
+        derived().pop_impl();
+    }
+
+    T& top() const {
+        if (empty()) {
+            throw std::out_of_range("Stack is empty");
+        }
+        return derived().top_impl();
+    }
+
+    bool empty() const {
+        return derived().empty_impl();
+    }
+
+    std::ptrdiff_t size() const {
+        return derived().size_impl();
+    }
+
+    void swap(Derived& other) {
+        derived().swap_impl(other);
+    }
+
+    void merge(Derived& other) {
+        derived().merge_impl(other);
+    }
+
+    bool operator==(const Derived& rhs) const {
+        return size() == rhs.size() && derived().compare_impl(rhs);
+    }
+
+    bool operator!=(const Derived& rhs) const {
+        return !(*this == rhs);
+    }
+
+protected:
+    // Удаление через указатель на базу не предусмотрено: деструктор не виртуальный
+    StackBase() = default;
+    ~StackBase() = default;
+
+private:
+    Derived& derived() {
+        return static_cast<Derived&>(*this);
+    }
+
+    const Derived& derived() const {
+        return static_cast<const Derived&>(*this);
+    }
+};
+
+template <typename Derived, typename T>
+std::ostream& operator<<(std::ostream& os, const StackBase<Derived, T>& stack) {
+    static_cast<const Derived&>(stack).printToStream(os);
+    return os;
+}
+
+// Интерфейс стека для полиморфизма во время выполнения; конкретный стек
+// подключается к нему через StackAdapter. Тип реализации определяется по
+// метке — адресу, уникальному для каждого класса, — а не через RTTI:
+// сравнение указателей без виртуального вызова, работает и с -fno-rtti.
 template <typename T>
 class IStackBase {
 public:
     virtual ~IStackBase() = default;
+
+    const void* type_tag() const {
+        return type_tag_;
+    }
+
+    bool same_type(const IStackBase<T>& other) const {
+        return type_tag_ == other.type_tag_;
+    }
     
-    // Абстрактные методы, которые дочерние классы должны реализовать
+    // Абстрактные методы, которые дочерние классы должны реализовать.
+    // pop_impl и top_impl сами бросают std::out_of_range для пустого стека,
+    // а compare_impl сам сравнивает размеры: обёртка над стеком делает это
+    // без лишних виртуальных вызовов
     virtual void push_impl(const T& value) = 0;
     virtual void pop_impl() = 0;
     virtual T& top_impl() const = 0;
@@ -26,16 +113,10 @@ public:
     }
     
     void pop() {
-        if (empty()) {
-            throw std::out_of_range("Stack is empty");
-        }
         pop_impl();
     }
     
     T& top() const {
-        if (empty()) {
-            throw std::out_of_range("Stack is empty");
-        }
         return top_impl();
     }
     
@@ -53,14 +134,14 @@ public:
     virtual void merge_impl(IStackBase<T>& other) = 0;
     
     void swap(IStackBase<T>& other) {
-        if (typeid(*this) != typeid(other)) {
+        if (!same_type(other)) {
             throw std::invalid_argument("Can only swap with the same stack type");
         }
         swap_impl(other);
     }
     
     void merge(IStackBase<T>& other) {
-        if (typeid(*this) != typeid(other)) {
+        if (!same_type(other)) {
             throw std::invalid_argument("Can only merge with the same stack type");
         }
         merge_impl(other);
@@ -70,7 +151,7 @@ public:
     virtual bool compare_impl(const IStackBase<T>& rhs) const = 0;
     
     bool operator==(const IStackBase<T>& rhs) const {
-        if (typeid(*this) != typeid(rhs) || size() != rhs.size()) {
+        if (!same_type(rhs)) {
             return false;
         }
         return compare_impl(rhs);
@@ -82,6 +163,12 @@ public:
     
     // Метод для вывода в поток
     virtual void printToStream(std::ostream& os) const = 0;
+
+protected:
+    explicit IStackBase(const void* type_tag) : type_tag_(type_tag) {}
+
+private:
+    const void* type_tag_;      //!< одинаков у всех объектов одного класса
 };
 
 // Глобальный оператор вывода (реализован один раз в базовом классе без friend)
@@ -91,4 +178,102 @@ std::ostream& operator<<(std::ostream& os, const IStackBase<T>& stack) {
     return os;
 }
 
+// Тонкая обёртка со стёртым типом: хранит стек на StackBase и отдаёт его
+// через IStackBase. Каждая операция — один виртуальный вызов: проверки
+// пустоты и размера выполняет встроенный StackBase внутри него; swap, merge
+// и == с обёрткой того же типа, известной статически, обходятся без них.
+template <typename Stack>
+class StackAdapter : public IStackBase<typename Stack::value_type> {
+public:
+    using T = typename Stack::value_type;
+    using IStackBase<T>::swap;
+    using IStackBase<T>::merge;
+    using IStackBase<T>::operator==;
+    using IStackBase<T>::operator!=;
+
+    StackAdapter() : IStackBase<T>(&kTypeTag) {}
+
+    explicit StackAdapter(Stack stack) : IStackBase<T>(&kTypeTag), stack_(std::move(stack)) {}
+
+    Stack& get() {
+        return stack_;
+    }
+
+    const Stack& get() const {
+        return stack_;
+    }
+
+    void push_impl(const T& value) override {
+        stack_.push_impl(value);
+    }
+
+    void pop_impl() override {
+        stack_.pop();
+    }
+
+    T& top_impl() const override {
+        return stack_.top();
+    }
+
+    bool empty_impl() const override {
+        return stack_.empty_impl();
+    }
+
+    std::ptrdiff_t size_impl() const override {
+        return stack_.size_impl();
+    }
+
+    IStackBase<T>* create_instance() const override {
+        return new StackAdapter<Stack>();
+    }
+
+    // После проверки метки static_cast безопасен: метка есть только у этого
+    // класса. *_impl доступны и напрямую, поэтому чужой тип — та же ошибка,
+    // что и в IStackBase::swap/merge
+    void swap_impl(IStackBase<T>& other) override {
+        if (!this->same_type(other)) {
+            throw std::invalid_argument("Can only swap with the same stack type");
+        }
+        swap(static_cast<StackAdapter<Stack>&>(other));
+    }
+
+    void merge_impl(IStackBase<T>& other) override {
+        if (!this->same_type(other)) {
+            throw std::invalid_argument("Can only merge with the same stack type");
+        }
+        merge(static_cast<StackAdapter<Stack>&>(other));
+    }
+
+    bool compare_impl(const IStackBase<T>& rhs) const override {
+        return this->same_type(rhs) && *this == static_cast<const StackAdapter<Stack>&>(rhs);
+    }
+
+    void swap(StackAdapter<Stack>& other) {
+        stack_.swap(other.stack_);
+    }
+
+    void merge(StackAdapter<Stack>& other) {
+        stack_.merge(other.stack_);
+    }
+
+    bool operator==(const StackAdapter<Stack>& rhs) const {
+        return stack_ == rhs.stack_;
+    }
+
+    bool operator!=(const StackAdapter<Stack>& rhs) const {
+        return !(stack_ == rhs.stack_);
+    }
+
+    void printToStream(std::ostream& os) const override {
+        stack_.printToStream(os);
+    }
+
+private:
+    // Не const: неизменяемые одинаковые объекты компоновщик вправе слить в
+    // один (-fmerge-all-constants, /OPT:ICF), и метки разных классов совпали бы
+    inline static char kTypeTag;
+
+    Stack stack_;
+};
+
 #endif // STACK_BASE_HPP
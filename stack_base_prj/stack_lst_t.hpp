@@ -3,39 +3,63 @@
 
 #include <initializer_list>
 #include <cstddef>
+#include <memory>
 #include <stdexcept>
 #include <ostream>
+#include <type_traits>
 #include "stack_base.hpp"
+#include "node_pool.hpp"
+#include "alloc_tracking.hpp"
 
+// Откуда стек берёт узлы: свой пул или общий пул потока. Общий пул
+// переиспользует узлы между стеками потока; каждый такой стек держит
+// ссылку на пул, поэтому пул живёт, пока жив поток или хоть один его
+// стек (статический стек или переживший поток безопасен). Пул не
+// потокобезопасен: стеки одного пула нельзя использовать из разных
+// потоков одновременно
+enum class NodePoolKind {
+    PerStack,
+    ThreadShared
+};
+
+// Стек на односвязном списке с узлами из пула. Объект стека крупнее
+// пары указателей: в нём лежат свой пул и ссылка на общий (88 байт
+// на 64-битной платформе). Свой пул выделяет первый блок только при
+// первом push и всего на 4 узла, так что пустые и маленькие стеки почти
+// не тратят памяти сверх этого; большие растят блоки до 4096 узлов.
 template <typename T>
-class StackLstT : public IStackBase<T> {
+class StackLstT : public StackBase<StackLstT<T>, T> {
 public:
     StackLstT() = default;
     
+    explicit StackLstT(NodePoolKind kind) {
+        if (kind == NodePoolKind::ThreadShared) {
+            shared_ = shared_pool();
+            pool_ = shared_.get();
+        }
+    }
+    
     ~StackLstT() {
         clear();
     }
     
-    StackLstT(const StackLstT<T>& other) : StackLstT() {
+    StackLstT(const StackLstT<T>& other)
+        : StackLstT(other.uses_shared_pool() ? NodePoolKind::ThreadShared : NodePoolKind::PerStack) {
         if (other.empty()) {
             return;
         }
         
-        Node* curr_other = other.head_;
-        head_ = new Node{curr_other->value, nullptr};
-        Node* curr = head_;
-        size_ = 1;
-        
-        curr_other = curr_other->next;
-        while (curr_other) {
-            curr->next = new Node{curr_other->value, nullptr};
-            curr = curr->next;
-            curr_other = curr_other->next;
-            size_++;
-        }
+        ALLOC_TRACK_COPY("StackLstT", other.size_ * sizeof(Node));
+        head_ = copy_nodes(other.head_);
+        size_ = other.size_;
     }
     
-    StackLstT(StackLstT<T>&& other) : head_(other.head_), size_(other.size_) {
+    StackLstT(StackLstT<T>&& other)
+        : head_(other.head_)
+        , size_(other.size_)
+        , own_pool_(std::move(other.own_pool_))
+        , shared_(other.shared_)
+        , pool_(other.uses_shared_pool() ? other.pool_ : &own_pool_) {
         other.head_ = nullptr;
         other.size_ = 0;
     }
@@ -46,66 +70,81 @@ public:
         }
     }
   
-    void push_impl(const T& value) override {
-        head_ = new Node{value, head_};
+    void push_impl(const T& value) {
+        head_ = pool_->create(value, head_);
         size_++;
     }
     
-    void pop_impl() override {
+    void pop_impl() {
         Node* temp = head_;
         head_ = head_->next;
-        delete temp;
+        pool_->destroy(temp);
         size_--;
     }
     
-    T& top_impl() const override {
+    T& top_impl() const {
         return head_->value;
     }
     
-    bool empty_impl() const override {
+    bool empty_impl() const {
         return head_ == nullptr;
     }
     
-    std::ptrdiff_t size_impl() const override {
+    std::ptrdiff_t size_impl() const {
         return size_;
     }
     
-    IStackBase<T>* create_instance() const override {
-        return new StackLstT<T>();
-    }
-    
-    void swap_impl(IStackBase<T>& other) override {
-        StackLstT<T>* other_lst = dynamic_cast<StackLstT<T>*>(&other);
-        if (other_lst) {
-            std::swap(head_, other_lst->head_);
-            std::swap(size_, other_lst->size_);
+    void swap_impl(StackLstT<T>& other) {
+        bool shared = uses_shared_pool();
+        bool other_shared = other.uses_shared_pool();
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+        own_pool_.swap(other.own_pool_);
+        std::swap(shared_, other.shared_);
+        std::swap(pool_, other.pool_);
+        if (!other_shared) {
+            pool_ = &own_pool_;
+        }
+        if (!shared) {
+            other.pool_ = &other.own_pool_;
         }
     }
     
-    void merge_impl(IStackBase<T>& other) override {
-        StackLstT<T>* other_lst = dynamic_cast<StackLstT<T>*>(&other);
-        if (!other_lst) {
+    void merge_impl(StackLstT<T>& other) {
+        if (other.empty()) {
             return;
         }
         
-        if (other_lst->empty()) {
-            return;
+        // Узлы другого стека переходят в наш пул. Свой пул другого стека
+        // забирается целиком, только если и наш пул свой: в общем пуле его
+        // блоки пролежали бы до конца потока. Иначе узлы копируются, а
+        // clear() другого стека отдаёт его блоки сразу
+        if (other.pool_ != pool_) {
+            if (!other.uses_shared_pool() && !uses_shared_pool()) {
+                pool_->absorb(other.own_pool_);
+            } else {
+                Node* copy = copy_nodes(other.head_);
+                std::ptrdiff_t count = other.size_;
+                other.clear();
+                other.head_ = copy;
+                other.size_ = count;
+            }
         }
         
         // Если текущий стек пуст, просто забираем содержимое другого
         if (this->empty()) {
-            head_ = other_lst->head_;
-            size_ = other_lst->size_;
-            other_lst->head_ = nullptr;
-            other_lst->size_ = 0;
+            head_ = other.head_;
+            size_ = other.size_;
+            other.head_ = nullptr;
+            other.size_ = 0;
             return;
         }
         
         // Сохраняем указатель на голову другого стека
-        Node* other_head = other_lst->head_;
+        Node* other_head = other.head_;
         
         // Обновляем размер
-        size_ += other_lst->size_;
+        size_ += other.size_;
         
         // Добавляем элементы другого стека в начало текущего
         Node* last_other = other_head;
@@ -117,18 +156,13 @@ public:
         head_ = other_head;
         
         // Очищаем другой стек
-        other_lst->head_ = nullptr;
-        other_lst->size_ = 0;
+        other.head_ = nullptr;
+        other.size_ = 0;
     }
     
-    bool compare_impl(const IStackBase<T>& rhs) const override {
-        const StackLstT<T>* rhs_lst = dynamic_cast<const StackLstT<T>*>(&rhs);
-        if (!rhs_lst) {
-            return false;
-        }
-        
+    bool compare_impl(const StackLstT<T>& rhs) const {
         Node* curr1 = head_;
-        Node* curr2 = rhs_lst->head_;
+        Node* curr2 = rhs.head_;
         
         while (curr1 && curr2) {
             if (curr1->value != curr2->value) {
@@ -141,7 +175,7 @@ public:
         return true;
     }
     
-    void printToStream(std::ostream& os) const override {
+    void printToStream(std::ostream& os) const {
         os << "[";
         Node* curr = head_;
         bool first = true;
@@ -171,26 +205,88 @@ public:
             clear();
             head_ = other.head_;
             size_ = other.size_;
+            own_pool_.swap(other.own_pool_);
+            shared_ = other.shared_;
+            pool_ = other.uses_shared_pool() ? other.pool_ : &own_pool_;
             other.head_ = nullptr;
             other.size_ = 0;
         }
         return *this;
     }
-
-private:
-    void clear() {
-        while (!this->empty()) {
-            this->pop();
-        }
+    
+    bool uses_shared_pool() const {
+        return pool_ != &own_pool_;
+    }
+    
+    // Блоков в пуле, из которого стек берёт узлы
+    std::size_t pool_block_count() const {
+        return pool_->block_count();
     }
     
+    // Узлов во всех блоках этого пула, занятых и свободных
+    std::size_t pool_slot_count() const {
+        return pool_->slot_count();
+    }
+
+private:
     struct Node {
         T value;
         Node* next = nullptr;
     };
+    
+    // Поток держит свою ссылку до завершения, стеки — свои
+    static const std::shared_ptr<NodePool<Node>>& shared_pool() {
+        thread_local std::shared_ptr<NodePool<Node>> pool = std::make_shared<NodePool<Node>>("StackLstT");
+        return pool;
+    }
+    
+    // Свой пул освобождается блоками целиком; деструкторы элементов
+    // вызываются, только если они что-то делают. Узлы общего пула
+    // возвращаются в его список свободных
+    void clear() {
+        if (uses_shared_pool() || !std::is_trivially_destructible<T>::value) {
+            while (head_) {
+                Node* next = head_->next;
+                if (uses_shared_pool()) {
+                    pool_->destroy(head_);
+                } else {
+                    head_->~Node();
+                }
+                head_ = next;
+            }
+        }
+        if (!uses_shared_pool()) {
+            own_pool_.release();
+        }
+        head_ = nullptr;
+        size_ = 0;
+    }
+    
+    // Копия цепочки узлов в нашем пуле с тем же порядком
+    Node* copy_nodes(const Node* first) {
+        Node* copy = nullptr;
+        Node** link = &copy;
+        try {
+            for (; first; first = first->next) {
+                *link = pool_->create(first->value, nullptr);
+                link = &(*link)->next;
+            }
+        } catch (...) {
+            while (copy) {
+                Node* next = copy->next;
+                pool_->destroy(copy);
+                copy = next;
+            }
+            throw;
+        }
+        return copy;
+    }
 
     Node* head_ = nullptr;
     std::ptrdiff_t size_ = 0;
+    NodePool<Node> own_pool_{"StackLstT"};
+    std::shared_ptr<NodePool<Node>> shared_;    //!< общий пул, если стек им пользуется
+    NodePool<Node>* pool_ = &own_pool_;         //!< &own_pool_ или shared_.get()
 };
 
 #endif // STACKLSTT_HPP
\ No newline at end of file
@@ -1,8 +1,10 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "../dynamic_array/doctest.h"
 #include "stack_arr_t.hpp"
+#include "stack_lst_t.hpp"
 #include <string>
 #include <sstream>
+#include <memory>
 
 TEST_CASE("StackArrT - базовые операции с int") {
     StackArrT<int> stack;
@@ -131,4 +133,69 @@ TEST_CASE("StackArrT - оператор вывода") {
     std::ostringstream oss2;
     oss2 << strStack;
     CHECK(oss2.str() == "[hello, world]");
-} 
\ No newline at end of file
+} 
+
+TEST_CASE("StackArrT - через IStackBase") {
+    StackAdapter<StackArrT<int>> adapter(StackArrT<int>{1, 2});
+    IStackBase<int>& stack = adapter;
+    
+    SUBCASE("Операции и проверки") {
+        stack.push(3);
+        CHECK(stack.size() == 3);
+        CHECK(stack.top() == 3);
+        stack.pop();
+        stack.pop();
+        stack.pop();
+        CHECK(stack.empty());
+        CHECK_THROWS_AS(stack.pop(), std::out_of_range);
+        CHECK_THROWS_AS(stack.top(), std::out_of_range);
+    }
+    
+    SUBCASE("swap, merge и сравнение") {
+        std::unique_ptr<IStackBase<int>> other(stack.create_instance());
+        other->push(1);
+        other->push(2);
+        CHECK(stack == *other);
+        
+        other->push(5);
+        stack.swap(*other);
+        CHECK(stack.size() == 3);
+        CHECK(other->size() == 2);
+        
+        stack.merge(*other);
+        CHECK(stack.size() == 5);
+        CHECK(other->empty());
+        CHECK(adapter.get().size() == 5);
+    }
+    
+    SUBCASE("Вывод") {
+        std::ostringstream oss;
+        oss << stack;
+        CHECK(oss.str() == "[1, 2]");
+    }
+    
+    SUBCASE("Стеки разных типов") {
+        StackAdapter<StackLstT<int>> list_adapter(StackLstT<int>{1, 2});
+        IStackBase<int>& list = list_adapter;
+        CHECK_FALSE(stack.same_type(list));
+        CHECK(stack != list);
+        CHECK_THROWS_AS(stack.swap(list), std::invalid_argument);
+        CHECK_THROWS_AS(stack.merge(list), std::invalid_argument);
+        CHECK_THROWS_AS(stack.swap_impl(list), std::invalid_argument);
+        CHECK_THROWS_AS(stack.merge_impl(list), std::invalid_argument);
+        CHECK(stack.size() == 2);
+        CHECK(list.size() == 2);
+    }
+    
+    SUBCASE("Та же обёртка без виртуальных вызовов") {
+        StackAdapter<StackArrT<int>> other(StackArrT<int>{1, 2});
+        CHECK(adapter.same_type(other));
+        CHECK(adapter == other);
+        other.push(3);
+        adapter.merge(other);
+        CHECK(adapter.size() == 5);
+        CHECK(other.empty());
+        adapter.swap(other);
+        CHECK(adapter.empty());
+    }
+}
@@ -3,6 +3,8 @@
 #include "stack_lst_t.hpp"
 #include <string>
 #include <sstream>
+#include <memory>
+#include <thread>
 
 TEST_CASE("StackLstT - базовые операции с int") {
     StackLstT<int> stack;
@@ -131,4 +133,167 @@ TEST_CASE("StackLstT - оператор вывода") {
     std::ostringstream oss2;
     oss2 << strStack;
     CHECK(oss2.str() == "[world, hello]");
-} 
\ No newline at end of file
+} 
+
+TEST_CASE("StackLstT - через IStackBase") {
+    StackAdapter<StackLstT<int>> adapter(StackLstT<int>{1, 2});
+    IStackBase<int>& stack = adapter;
+    
+    SUBCASE("Операции и проверки") {
+        stack.push(3);
+        CHECK(stack.size() == 3);
+        CHECK(stack.top() == 3);
+        stack.pop();
+        stack.pop();
+        stack.pop();
+        CHECK(stack.empty());
+        CHECK_THROWS_AS(stack.pop(), std::out_of_range);
+        CHECK_THROWS_AS(stack.top(), std::out_of_range);
+    }
+    
+    SUBCASE("swap, merge и сравнение") {
+        std::unique_ptr<IStackBase<int>> other(stack.create_instance());
+        other->push(1);
+        other->push(2);
+        CHECK(stack == *other);
+        
+        other->push(5);
+        stack.swap(*other);
+        CHECK(stack.size() == 3);
+        CHECK(other->size() == 2);
+        
+        stack.merge(*other);
+        CHECK(stack.size() == 5);
+        CHECK(other->empty());
+        CHECK(adapter.get().size() == 5);
+    }
+    
+    SUBCASE("Вывод") {
+        std::ostringstream oss;
+        oss << stack;
+        CHECK(oss.str() == "[2, 1]");
+    }
+}
+
+
+TEST_CASE("StackLstT - пул узлов") {
+    SUBCASE("Узлы переиспользуются, clear освобождает блоки") {
+        StackLstT<int> stack;
+        for (int i = 0; i < 1000; ++i) {
+            stack.push(i);
+        }
+        std::size_t blocks = stack.pool_block_count();
+        CHECK(blocks > 1);
+        CHECK(blocks < 10);
+        for (int round = 0; round < 5; ++round) {
+            while (!stack.empty()) {
+                stack.pop();
+            }
+            for (int i = 0; i < 1000; ++i) {
+                stack.push(i);
+            }
+        }
+        CHECK(stack.pool_block_count() == blocks);
+        CHECK(stack.top() == 999);
+        
+        StackLstT<int> copy(stack);
+        copy = StackLstT<int>{1, 2};
+        CHECK(copy.size() == 2);
+        CHECK(copy.top() == 2);
+    }
+    
+    SUBCASE("Маленький стек не держит большой блок") {
+        StackLstT<int> stack;
+        CHECK(stack.pool_block_count() == 0);
+        stack.push(1);
+        CHECK(stack.pool_block_count() == 1);
+        CHECK(stack.pool_slot_count() <= 4);
+        for (int i = 0; i < 100; ++i) {
+            stack.push(i);
+        }
+        CHECK(stack.pool_slot_count() >= 101);
+        CHECK(stack.pool_slot_count() < 2 * 101 + 4);
+    }
+    
+    SUBCASE("Общий пул потока") {
+        StackLstT<std::string> a(NodePoolKind::ThreadShared);
+        StackLstT<std::string> b(NodePoolKind::ThreadShared);
+        CHECK(a.uses_shared_pool());
+        a.push("x");
+        b.push("y");
+        CHECK(a.pool_block_count() == b.pool_block_count());
+        
+        a.merge(b);
+        CHECK(a.size() == 2);
+        CHECK(a.top() == "y");
+        CHECK(b.empty());
+        
+        StackLstT<std::string> copy(a);
+        CHECK(copy.uses_shared_pool());
+        CHECK(copy == a);
+    }
+    
+    SUBCASE("Стеки с разными пулами") {
+        StackLstT<std::string> own{"a", "b"};
+        StackLstT<std::string> shared(NodePoolKind::ThreadShared);
+        shared.push("c");
+        
+        own.swap(shared);
+        CHECK(own.uses_shared_pool());
+        CHECK_FALSE(shared.uses_shared_pool());
+        CHECK(own.top() == "c");
+        CHECK(shared.top() == "b");
+        
+        // В общий пул узлы копируются, блоки своего пула освобождаются сразу
+        own.merge(shared);
+        CHECK(own.size() == 3);
+        CHECK(shared.pool_block_count() == 0);
+        
+        // Свой пул поглощается своим целиком
+        StackLstT<std::string> donor{"p", "q"};
+        StackLstT<std::string> receiver{"r"};
+        std::size_t blocks = donor.pool_block_count() + receiver.pool_block_count();
+        receiver.merge(donor);
+        CHECK(receiver.pool_block_count() == blocks);
+        CHECK(donor.pool_block_count() == 0);
+        CHECK(receiver.top() == "q");
+        shared.push("d");
+        shared.merge(own);
+        CHECK(shared.size() == 4);
+        CHECK(own.empty());
+        
+        std::ostringstream oss;
+        oss << shared;
+        CHECK(oss.str() == "[b, a, c, d]");
+        
+        StackLstT<std::string> moved(std::move(shared));
+        CHECK(moved.size() == 4);
+        CHECK(shared.empty());
+        moved.pop();
+        CHECK(moved.top() == "a");
+    }
+}
+
+TEST_CASE("StackLstT - общий пул переживает поток") {
+    // Статический стек разрушается после thread_local-переменных главного потока
+    static StackLstT<std::string> global(NodePoolKind::ThreadShared);
+    global.push("global");
+    
+    StackLstT<std::string> survivor;
+    std::thread worker([&survivor] {
+        StackLstT<std::string> local(NodePoolKind::ThreadShared);
+        for (int i = 0; i < 100; ++i) {
+            local.push(std::to_string(i));
+        }
+        survivor = std::move(local);
+    });
+    worker.join();
+    
+    // Поток завершён, его пул держит только survivor
+    CHECK(survivor.uses_shared_pool());
+    CHECK(survivor.size() == 100);
+    CHECK(survivor.top() == "99");
+    survivor.pop();
+    survivor.push("again");
+    CHECK(survivor.top() == "again");
+}